@@ -11,10 +11,17 @@
 
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
 #include "boomerang/util/CFGDotWriter.h"
+#include "boomerang/util/Tracer.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
 #include <QTextStream>
 
 #include <iostream>
@@ -54,10 +61,14 @@ static void help()
 "  --ssl <file>     : Use <file> as SSL specification file\n"
 "  -e <addr>        : Decode or decompile the procedure beginning at addr, and callees\n"
 "  -E <addr>        : Equivalent to -nc -e <addr>\n"
+"  --only <glob>    : Only decompile procedures whose name matches <glob>, and their callees\n"
+"  --range <a> <b>  : Only decompile procedures starting in [a, b), and their callees\n"
+"  --depth <n>      : Only decompile callees up to <n> calls below the selected procedures\n"
 "  -ic              : Decode through type 0 Indirect Calls\n"
 "  -S <min>         : Stop decompilation after specified number of minutes\n"
 "  -t               : Trace (print address of) every instruction decoded\n"
 "  -a               : Assume ABI compliance\n"
+"  --ir-arena       : Allocate the IR of each procedure from a per-procedure memory pool\n"
 "\n"
 "Output\n"
 "  --version        : Print version information and exit\n"
@@ -69,6 +80,8 @@ static void help()
 "  -gd <dot_file>   : Generate a dotty graph of the program's CFG(s)\n"
 "  -gc              : Generate a call graph to callgraph.dot\n"
 "  -gs              : Generate a symbol file (symbols.h). Implies --decode-only.\n"
+"  --stats <file>   : Write timing and size statistics of the decompilation as JSON to <file>\n"
+"  --trace <file>   : Write a trace of decompiler events in Chrome trace event format to <file>\n"
 "\n"
 "Misc.\n"
 "  -i [<file>]      : Interactive mode; execute commands from <file>, if present\n"
@@ -182,6 +195,77 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             m_project->getSettings()->stopBeforeDecompile = true;
             continue;
         }
+        else if (arg == "--stats") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            m_statsFile = args[i];
+            continue;
+        }
+        else if (arg == "--trace") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            m_traceFile = args[i];
+            Tracer::get().enable();
+            continue;
+        }
+        else if (arg == "--ir-arena") {
+            m_project->getSettings()->useIRArena = true;
+            continue;
+        }
+        else if (arg == "--only") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            m_project->getSettings()->m_scope.addNamePattern(args[i]);
+            continue;
+        }
+        else if (arg == "--range") {
+            if (i + 2 >= args.size()) {
+                help();
+                return 1;
+            }
+
+            bool fromOk        = false;
+            bool toOk          = false;
+            const Address from = Address(args[i + 1].toLongLong(&fromOk, 0));
+            const Address to   = Address(args[i + 2].toLongLong(&toOk, 0));
+
+            if (!fromOk || !toOk || from >= to) {
+                std::cerr << "'--range': Bad range '" << args[i + 1].toStdString() << " "
+                          << args[i + 2].toStdString() << "' (try --help)." << std::endl;
+                return 1;
+            }
+
+            m_project->getSettings()->m_scope.addAddressRange(from, to);
+            i += 2;
+            continue;
+        }
+        else if (arg == "--depth") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            bool converted  = false;
+            const int depth = args[i].toInt(&converted, 0);
+
+            if (!converted || depth < 0) {
+                std::cerr << "'--depth': Bad argument '" << args[i].toStdString()
+                          << "' (try --help)." << std::endl;
+                return 1;
+            }
+
+            m_project->getSettings()->m_scope.setMaxCalleeDepth(depth);
+            continue;
+        }
         else if (arg == "--decode-only") {
             m_project->getSettings()->stopBeforeDecompile = true;
             continue;
@@ -500,6 +584,9 @@ int CommandlineDriver::decompile()
 void CommandlineDriver::onCompilationTimeout()
 {
     LOG_WARN("Compilation timed out, Boomerang will now exit");
+
+    // The trace is most useful for finding out where the time went
+    writeTrace();
     exit(1);
 }
 
@@ -508,7 +595,12 @@ bool CommandlineDriver::loadAndDecode(const QString &fname, const QString &pname
 {
     assert(m_project);
 
+    QElapsedTimer timer;
+    timer.start();
+
     const bool ok = m_project->loadBinaryFile(fname);
+    m_phaseMs["load"] = timer.restart();
+
     if (!ok) {
         LOG_ERROR("Loading '%1' failed.", fname);
         return false;
@@ -518,7 +610,10 @@ bool CommandlineDriver::loadAndDecode(const QString &fname, const QString &pname
     assert(prog);
 
     prog->setName(pname);
-    return m_project->decodeBinaryFile();
+    const bool decoded  = m_project->decodeBinaryFile();
+    m_phaseMs["decode"] = timer.elapsed();
+
+    return decoded;
 }
 
 
@@ -536,20 +631,41 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
             CFGDotWriter().writeCFG(m_project->getProg(), m_project->getSettings()->dotFile);
         }
 
+        if (!m_statsFile.isEmpty() && !writeStatistics(m_statsFile)) {
+            LOG_ERROR("Cannot write statistics to '%1'", m_statsFile);
+        }
+
+        writeTrace();
         return 0;
     }
 
+    QElapsedTimer timer;
+    timer.start();
+
     m_project->decompileBinaryFile();
+    m_phaseMs["decompile"] = timer.elapsed();
 
     if (!m_project->getSettings()->dotFile.isEmpty()) {
         CFGDotWriter().writeCFG(m_project->getProg(), m_project->getSettings()->dotFile);
     }
 
+    if (!m_statsFile.isEmpty()) {
+        collectStatistics();
+    }
+
+    timer.restart();
     m_project->generateCode();
+    m_phaseMs["codegen"] = timer.elapsed();
 
     QDir outDir = m_project->getSettings()->getOutputDirectory();
     LOG_MSG("Output written to '%1'", outDir.absolutePath());
 
+    if (!m_statsFile.isEmpty() && !writeStatistics(m_statsFile)) {
+        LOG_ERROR("Cannot write statistics to '%1'", m_statsFile);
+    }
+
+    writeTrace();
+
     time_t end;
     time(&end);
     const int hours = static_cast<int>((end - start) / 60 / 60);
@@ -559,3 +675,81 @@ int CommandlineDriver::decompile(const QString &fname, const QString &pname)
     LOG_MSG("Completed in %1 hours %2 minutes %3 seconds.", hours, mins, secs);
     return 0;
 }
+
+
+void CommandlineDriver::collectStatistics()
+{
+    const Prog *prog = m_project->getProg();
+
+    int numProcs      = 0;
+    int numStatements = 0;
+
+    for (const auto &module : prog->getModuleList()) {
+        for (const Function *func : *module) {
+            if (func->isLib()) {
+                continue;
+            }
+
+            numProcs++;
+            for (const SharedStmt &stmt : static_cast<const UserProc *>(func)->getStatements()) {
+                Q_UNUSED(stmt);
+                numStatements++;
+            }
+        }
+    }
+
+    QJsonObject passes;
+    for (int i = 0; i < static_cast<int>(PassID::NUM_PASSES); i++) {
+        const PassID passID = static_cast<PassID>(i);
+        const IPass *pass   = PassManager::get()->getPass(passID);
+
+        if (pass) {
+            passes[pass->getName()] = PassManager::get()->getNumExecutions(passID);
+        }
+    }
+
+    m_stats["numProcs"]      = numProcs;
+    m_stats["numStatements"] = numStatements;
+    m_stats["passes"]        = passes;
+}
+
+
+bool CommandlineDriver::writeStatistics(const QString &fileName) const
+{
+    QJsonObject stats = m_stats;
+    QJsonObject phases;
+
+    for (auto it = m_phaseMs.begin(); it != m_phaseMs.end(); ++it) {
+        phases[it.key()] = it.value();
+    }
+
+    stats["binary"] = m_pathToBinary;
+    stats["phases"] = phases;
+
+    QFile file(m_project->getSettings()->getWorkingDirectory().absoluteFilePath(fileName));
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+
+    file.write(QJsonDocument(stats).toJson());
+    return true;
+}
+
+
+void CommandlineDriver::writeTrace() const
+{
+    if (m_traceFile.isEmpty()) {
+        return;
+    }
+
+    const QString fileName = m_project->getSettings()->getWorkingDirectory().absoluteFilePath(
+        m_traceFile);
+
+    if (!Tracer::get().writeChromeTrace(fileName)) {
+        LOG_ERROR("Cannot write trace to '%1'", fileName);
+    }
+    else if (Tracer::get().getNumDroppedEvents() > 0) {
+        LOG_WARN("Trace buffer was full; %1 of the oldest events were dropped",
+                 Tracer::get().getNumDroppedEvents());
+    }
+}
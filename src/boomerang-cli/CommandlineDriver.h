@@ -14,6 +14,8 @@
 
 #include "boomerang/core/Project.h"
 
+#include <QJsonObject>
+#include <QMap>
 #include <QObject>
 #include <QTimer>
 
@@ -70,6 +72,16 @@ private:
      */
     int decompile(const QString &fname, const QString &pname);
 
+    /// Count the procedures, statements and pass executions of the decompiled program.
+    /// Must be called before code generation.
+    void collectStatistics();
+
+    /// Write the statistics collected during decompilation as JSON to \p fileName.
+    bool writeStatistics(const QString &fileName) const;
+
+    /// Write the events recorded by the Tracer to the file given by --trace, if any.
+    void writeTrace() const;
+
 public slots:
     void onCompilationTimeout();
 
@@ -80,4 +92,10 @@ private:
     QTimer m_kill_timer;
     int minsToStopAfter = 0;
     QString m_pathToBinary;
+
+    QString m_statsFile;             ///< Where to write statistics to (empty = do not write)
+    QJsonObject m_stats;             ///< Statistics of the current decompilation
+    QMap<QString, qint64> m_phaseMs; ///< Wall clock time of each phase in milliseconds
+
+    QString m_traceFile; ///< Where to write the trace to (empty = tracing disabled)
 };
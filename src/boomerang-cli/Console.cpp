@@ -11,6 +11,7 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/GlobalUseIndex.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
 #include "boomerang/db/proc/UserProc.h"
@@ -801,6 +802,31 @@ CommandStatus Console::handlePrint(const QStringList &args)
 
         return CommandStatus::Success;
     }
+    else if (args[0] == "global-users") {
+        if (args.size() <= 1) {
+            std::cerr << "Too few arguments for command 'print global-users'" << std::endl;
+            return CommandStatus::Failure;
+        }
+
+        const GlobalUseIndex &globalUses = prog->getGlobalUses();
+        OStream outStream(stdout);
+
+        for (int i = 1; i < args.size(); i++) {
+            if (prog->getGlobalByName(args[i]) == nullptr) {
+                std::cerr << "Global '" << args[i].toStdString() << "' not found." << std::endl;
+                return CommandStatus::Failure;
+            }
+
+            outStream << args[i] << ":\n";
+
+            for (UserProc *proc : globalUses.getUsers(args[i])) {
+                outStream << "  " << proc->getName() << "\n";
+            }
+        }
+
+        outStream.flush();
+        return CommandStatus::Success;
+    }
     else if (args[0] == "use-graph") {
         if (args.size() <= 1) {
             std::cerr << "Too few arguments for command 'print use-graph'" << std::endl;
@@ -890,6 +916,8 @@ CommandStatus Console::handleHelp(const QStringList &args)
            "  print cfg [<proc1> [<proc2>...]]   : prints the Control Flow Graph of the program or "
            "a set of procedures.\n"
            "  print dfg <proc1> [<proc2>...]     : prints the Data Flow Graph of a proc.\n"
+           "  print global-users <glob1> [...]   : Print the procedures using the specified "
+           "global(s).\n"
            "  print rtl [<proc1> [<proc2>...]]   : Print the RTL(s) for a proc.\n"
            "  print use-graph <proc1> [<proc2>]  : Print the Use Graph of a proc.\n"
            "  replay <file>                      : Reads file and executes commands line by line.\n"
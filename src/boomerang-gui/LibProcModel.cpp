@@ -0,0 +1,115 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "LibProcModel.h"
+
+
+LibProcModel::LibProcModel(QObject *parent)
+    : ProcTableModel(parent)
+{
+}
+
+
+void LibProcModel::addOrUpdateProc(const QString &name, const QString &params)
+{
+    auto it = m_rowByName.find(name);
+    if (it != m_rowByName.end()) {
+        const int row      = it.value();
+        m_procs[row].params = params;
+
+        if (isRowVisible(row)) {
+            const QModelIndex idx = index(row, ColParams);
+            emit dataChanged(idx, idx, { Qt::DisplayRole });
+        }
+
+        return;
+    }
+
+    m_rowByName.insert(name, getNumProcs());
+    m_procs.push_back({ name, params });
+    rowsAppended();
+}
+
+
+bool LibProcModel::removeProc(const QString &name)
+{
+    auto it = m_rowByName.find(name);
+    if (it == m_rowByName.end()) {
+        return false;
+    }
+
+    const int row = it.value();
+
+    beginRemoveDataRow(row);
+    m_rowByName.erase(it);
+    m_procs.erase(m_procs.begin() + row);
+
+    // rows after the removed one moved up
+    for (int i = row; i < getNumProcs(); i++) {
+        m_rowByName[m_procs[i].name] = i;
+    }
+
+    endRemoveDataRow(row);
+    return true;
+}
+
+
+QString LibProcModel::getProcName(int row) const
+{
+    return (row >= 0 && row < getNumProcs()) ? m_procs[row].name : QString();
+}
+
+
+QString LibProcModel::getProcParams(int row) const
+{
+    return (row >= 0 && row < getNumProcs()) ? m_procs[row].params : QString();
+}
+
+
+int LibProcModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : 2;
+}
+
+
+QVariant LibProcModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || !isRowVisible(index.row()) || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (index.column()) {
+    case ColName: return m_procs[index.row()].name;
+    case ColParams: return m_procs[index.row()].params;
+    }
+
+    return QVariant();
+}
+
+
+QVariant LibProcModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (section) {
+    case ColName: return tr("Name");
+    case ColParams: return tr("Parameters");
+    }
+
+    return QVariant();
+}
+
+
+void LibProcModel::clearData()
+{
+    m_procs.clear();
+    m_rowByName.clear();
+}
@@ -0,0 +1,80 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang-gui/ProcTableModel.h"
+
+#include <QHash>
+#include <QString>
+
+#include <vector>
+
+
+/**
+ * Table of library procedures (name and parameters).
+ * Procedures are indexed by name.
+ */
+class LibProcModel : public ProcTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        ColName   = 0,
+        ColParams = 1
+    };
+
+public:
+    explicit LibProcModel(QObject *parent = nullptr);
+
+public:
+    /// Add the library procedure \p name, or update its parameters if it already exists.
+    void addOrUpdateProc(const QString &name, const QString &params);
+
+    /// Remove the library procedure \p name.
+    /// \returns false if there is no such procedure.
+    bool removeProc(const QString &name);
+
+    /// \returns the number of procedures, including the ones not yet visible.
+    int getNumProcs() const { return static_cast<int>(m_procs.size()); }
+
+    /// \returns the name of the procedure in row \p row.
+    QString getProcName(int row) const;
+
+    /// \returns the parameters of the procedure in row \p row.
+    QString getProcParams(int row) const;
+
+public:
+    /// \copydoc QAbstractTableModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+protected:
+    int getNumDataRows() const override { return getNumProcs(); }
+    void clearData() override;
+
+private:
+    struct Entry
+    {
+        QString name;
+        QString params;
+    };
+
+    std::vector<Entry> m_procs;
+    QHash<QString, int> m_rowByName;
+};
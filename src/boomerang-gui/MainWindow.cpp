@@ -10,9 +10,12 @@
 #include "MainWindow.h"
 
 #include "boomerang-gui/Decompiler.h"
+#include "boomerang-gui/LibProcModel.h"
+#include "boomerang-gui/ProcTreeModel.h"
 #include "boomerang-gui/RTLEditor.h"
 #include "boomerang-gui/SettingsDlg.h"
 #include "boomerang-gui/ui_About.h"
+#include "boomerang-gui/UserProcModel.h"
 #include "boomerang-gui/ui_MainWindow.h"
 
 #include "boomerang/ifc/ITypeRecovery.h"
@@ -20,6 +23,7 @@
 #include <QDesktopServices>
 #include <QFileDialog>
 #include <QSettings>
+#include <QSortFilterProxyModel>
 #include <QTextStream>
 #include <QToolButton>
 
@@ -78,6 +82,26 @@ MainWindow::MainWindow(QWidget *_parent)
     connect(this, SIGNAL(entryPointRemoved(Address)), m_decompiler,
             SLOT(removeEntryPoint(Address)));
 
+    m_userProcs       = new UserProcModel(this);
+    m_libProcs        = new LibProcModel(this);
+    m_procTree        = new ProcTreeModel(this);
+    m_sortedUserProcs = new QSortFilterProxyModel(this);
+    m_sortedLibProcs  = new QSortFilterProxyModel(this);
+
+    m_sortedUserProcs->setSourceModel(m_userProcs);
+    m_sortedLibProcs->setSourceModel(m_libProcs);
+    ui->tblUserProcs->setModel(m_sortedUserProcs);
+    ui->tblLibProcs->setModel(m_sortedLibProcs);
+    ui->twProcTree->setModel(m_procTree);
+
+    // Resize the columns once per batch of new rows, not once per row
+    connect(m_userProcs, &QAbstractItemModel::rowsInserted, ui->tblUserProcs,
+            &QTableView::resizeColumnsToContents);
+    connect(m_libProcs, &QAbstractItemModel::rowsInserted, ui->tblLibProcs,
+            &QTableView::resizeColumnsToContents);
+
+    connect(m_userProcs, &UserProcModel::procRenamed, m_decompiler, &Decompiler::renameProc);
+
     ui->tblUserProcs->horizontalHeader()->disconnect(SIGNAL(sectionClicked(int)));
     connect(ui->tblUserProcs->horizontalHeader(), &QHeaderView::sectionClicked, this,
             &MainWindow::onUserProcsHorizontalHeaderSectionClicked);
@@ -315,9 +339,9 @@ void MainWindow::showInitPage()
 
     ui->stackedWidget->setCurrentIndex(0);
     ui->tblEntryPoints->setRowCount(0);
-    ui->tblUserProcs->setRowCount(0);
-    ui->tblLibProcs->setRowCount(0);
-    ui->twProcTree->clear();
+    m_userProcs->clear();
+    m_libProcs->clear();
+    m_procTree->clear();
     ui->twModuleTree->clear();
 
     m_numDecompiledProcs = 0;
@@ -357,13 +381,7 @@ void MainWindow::showDecodePage()
 
     ui->stackedWidget->setCurrentIndex(2);
 
-    if (!ui->actDebugEnabled->isChecked()) {
-        ui->tblUserProcs->removeColumn(2);
-    }
-    else {
-        ui->tblUserProcs->setColumnCount(3);
-        ui->tblUserProcs->setHorizontalHeaderItem(2, new QTableWidgetItem(tr("Debug")));
-    }
+    m_userProcs->setDebugColumnVisible(ui->actDebugEnabled->isChecked());
 
     ui->actDecode->setEnabled(true);
 }
@@ -482,133 +500,52 @@ void MainWindow::generateCodeComplete()
 
 void MainWindow::showConsideringProc(const QString &calledByName, const QString &procName)
 {
-    QList<QTreeWidgetItem *> foundit = ui->twProcTree->findItems(procName, Qt::MatchExactly |
-                                                                               Qt::MatchRecursive);
-
-    if (foundit.isEmpty()) {
-        QStringList texts(procName);
+    const QModelIndex idx = m_procTree->addProc(calledByName, procName);
 
-        if (calledByName.isEmpty()) {
-            ui->twProcTree->addTopLevelItem(new QTreeWidgetItem(texts));
-        }
-        else {
-            QList<QTreeWidgetItem *> found = ui->twProcTree->findItems(
-                calledByName, Qt::MatchExactly | Qt::MatchRecursive);
-
-            if (!found.isEmpty()) {
-                QTreeWidgetItem *n = new QTreeWidgetItem(found.first(), texts);
-                n->setData(0, 1, procName);
-                ui->twProcTree->expandItem(found.first());
-                ui->twProcTree->scrollToItem(n);
-                ui->twProcTree->setCurrentItem(n, 0);
-            }
-        }
+    if (idx.isValid() && idx.parent().isValid()) {
+        ui->twProcTree->expand(idx.parent());
+        ui->twProcTree->scrollTo(idx);
+        ui->twProcTree->setCurrentIndex(idx);
     }
 }
 
 
 void MainWindow::showDecompilingProc(const QString &name)
 {
-    QList<QTreeWidgetItem *> foundit = ui->twProcTree->findItems(name, Qt::MatchExactly |
-                                                                           Qt::MatchRecursive);
+    const QModelIndex idx = m_procTree->setDecompiling(name);
 
-    if (!foundit.isEmpty()) {
-        ui->twProcTree->setCurrentItem(foundit.first(), 0);
-        foundit.first()->setForeground(0, QColor("blue"));
+    if (idx.isValid()) {
+        ui->twProcTree->setCurrentIndex(idx);
         m_numDecompiledProcs++;
     }
 
-    const int max = ui->tblUserProcs->rowCount();
-    ui->prgDecompile->setRange(0, max);
+    ui->prgDecompile->setRange(0, m_userProcs->getNumProcs());
     ui->prgDecompile->setValue(m_numDecompiledProcs);
 }
 
 
 void MainWindow::showNewUserProc(const QString &name, Address addr)
 {
-    const int nrows = ui->tblUserProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 1)->text() == name) {
-            return;
-        }
-    }
-
-    const QString s = addr.toString();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 0)->text() == s) {
-            return;
-        }
-    }
-
-    ui->tblUserProcs->setRowCount(nrows + 1);
-    ui->tblUserProcs->setItem(nrows, 0, new QTableWidgetItem(addr.toString()));
-    ui->tblUserProcs->setItem(nrows, 1, new QTableWidgetItem(name));
-    ui->tblUserProcs->item(nrows, 1)->setData(1, name);
-
-    if (ui->actDebugEnabled->isChecked()) {
-        QTableWidgetItem *d = new QTableWidgetItem("");
-        d->setCheckState(Qt::Checked);
-        ui->tblUserProcs->setItem(nrows, 2, d);
-    }
-
-    ui->tblUserProcs->resizeColumnsToContents();
-    ui->tblUserProcs->resizeRowsToContents();
+    m_userProcs->addProc(name, addr);
 }
 
 
 void MainWindow::showNewLibProc(const QString &name, const QString &params)
 {
-    const int nrows = ui->tblLibProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblLibProcs->item(i, 0)->text() == name) {
-            ui->tblLibProcs->item(i, 1)->setText(params);
-            return;
-        }
-    }
-
-    ui->tblLibProcs->setRowCount(nrows + 1);
-    ui->tblLibProcs->setItem(nrows, 0, new QTableWidgetItem(name));
-    ui->tblLibProcs->setItem(nrows, 1, new QTableWidgetItem(params));
-    ui->tblLibProcs->resizeColumnsToContents();
-    ui->tblLibProcs->resizeRowsToContents();
+    m_libProcs->addOrUpdateProc(name, params);
 }
 
 
 void MainWindow::showRemoveUserProc(const QString &name, Address addr)
 {
     Q_UNUSED(name);
-
-    const int nrows          = ui->tblUserProcs->rowCount();
-    const QString addrString = addr.toString();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblUserProcs->item(i, 0)->text() == addrString) {
-            ui->tblUserProcs->removeRow(i);
-            break;
-        }
-    }
-
-    ui->tblUserProcs->resizeColumnsToContents();
-    ui->tblUserProcs->resizeRowsToContents();
+    m_userProcs->removeProc(addr);
 }
 
 
 void MainWindow::showRemoveLibProc(const QString &name)
 {
-    const int nrows = ui->tblLibProcs->rowCount();
-
-    for (int i = 0; i < nrows; i++) {
-        if (ui->tblLibProcs->item(i, 0)->text() == name) {
-            ui->tblLibProcs->removeRow(i);
-            break;
-        }
-    }
-
-    ui->tblLibProcs->resizeColumnsToContents();
-    ui->tblLibProcs->resizeRowsToContents();
+    m_libProcs->removeProc(name);
 }
 
 
@@ -650,7 +587,7 @@ void MainWindow::showNewProcInCluster(const QString &name, const QString &module
         m_numCodeGenProcs++;
     }
 
-    ui->prgGenerateCode->setRange(0, ui->tblUserProcs->rowCount());
+    ui->prgGenerateCode->setRange(0, m_userProcs->getNumProcs());
     ui->prgGenerateCode->setValue(m_numCodeGenProcs);
 }
 
@@ -666,12 +603,9 @@ void MainWindow::showDebuggingPoint(const QString &name, const QString &descript
     statusBar()->showMessage(msg);
     ui->actDebugStep->setEnabled(true);
 
-    for (int i = 0; i < ui->tblUserProcs->rowCount(); i++) {
-        if ((ui->tblUserProcs->item(i, 1)->text() == name) &&
-            (ui->tblUserProcs->item(i, 2)->checkState() != Qt::Checked)) {
-            on_actDebugStep_triggered();
-            return;
-        }
+    if (!m_userProcs->isDebugEnabled(name)) {
+        on_actDebugStep_triggered();
+        return;
     }
 
     showRTLEditor(name);
@@ -701,25 +635,10 @@ void MainWindow::showRTLEditor(const QString &name)
 }
 
 
-void MainWindow::on_tblUserProcs_cellDoubleClicked(int row, int column)
+void MainWindow::on_tblUserProcs_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
-    showRTLEditor(ui->tblUserProcs->item(row, 1)->text());
-}
-
-
-void MainWindow::on_tblUserProcs_cellChanged(int row, int column)
-{
-    if (column == 0) {
-        // TODO: should we allow the user to change the address of a proc?
-    }
-
-    if (column == 1) {
-        const QString oldName = ui->tblUserProcs->item(row, 1)->data(1).toString();
-        const QString newName = ui->tblUserProcs->item(row, 1)->text();
-        m_decompiler->renameProc(oldName, newName);
-        ui->tblUserProcs->item(row, 1)->setData(1, newName);
-    }
+    const QModelIndex sourceIndex = m_sortedUserProcs->mapToSource(index);
+    showRTLEditor(m_userProcs->getProcName(sourceIndex.row()));
 }
 
 
@@ -766,10 +685,9 @@ void MainWindow::on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int co
 }
 
 
-void MainWindow::on_twProcTree_itemDoubleClicked(QTreeWidgetItem *item, int column)
+void MainWindow::on_twProcTree_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
-    showRTLEditor(item->text(0));
+    showRTLEditor(m_procTree->getProcName(index));
 }
 
 
@@ -809,26 +727,23 @@ void MainWindow::on_actDebugStep_triggered()
 
 void MainWindow::onUserProcsHorizontalHeaderSectionClicked(int logicalIndex)
 {
-    if (logicalIndex == 2) {
-        for (int i = 0; i < ui->tblUserProcs->rowCount(); i++) {
-            if (ui->tblUserProcs->item(i, 2) == nullptr) {
-                ui->tblUserProcs->setItem(i, 2, new QTableWidgetItem(""));
-            }
-
-            Qt::CheckState state = ui->tblUserProcs->item(i, 2)->checkState();
-            ui->tblUserProcs->item(i, 2)->setCheckState(state == Qt::Checked ? Qt::Unchecked
-                                                                             : Qt::Checked);
-        }
+    if (logicalIndex == UserProcModel::ColDebug) {
+        m_userProcs->toggleDebugEnabled();
     }
 }
 
 
-void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
+void MainWindow::on_tblLibProcs_doubleClicked(const QModelIndex &index)
 {
-    Q_UNUSED(column);
-    QString name = "";
+    // rows in the order they are displayed
+    const auto libProcText = [this](int row, int column) {
+        return m_sortedLibProcs->index(row, column).data().toString();
+    };
+
+    const int row  = index.row();
+    QString name   = "";
     QString sigFile;
-    QString params = ui->tblLibProcs->item(row, 1)->text();
+    QString params = libProcText(row, LibProcModel::ColParams);
     bool existing  = true;
 
     if (params == "<unknown>") {
@@ -836,10 +751,10 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
 
         // uhh, time to guess?
         for (int i = row; i >= 0; i--) {
-            params = ui->tblLibProcs->item(i, 1)->text();
+            params = libProcText(i, LibProcModel::ColParams);
 
             if (params != "<unknown>") {
-                name = ui->tblLibProcs->item(i, 0)->text();
+                name = libProcText(i, LibProcModel::ColName);
                 break;
             }
         }
@@ -849,7 +764,7 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
         }
     }
     else {
-        name = ui->tblLibProcs->item(row, 0)->text();
+        name = libProcText(row, LibProcModel::ColName);
     }
 
     sigFile          = m_decompiler->getSigFilePath(name);
@@ -904,7 +819,7 @@ void MainWindow::on_tblLibProcs_cellDoubleClicked(int row, int column)
         textCursor.movePosition(QTextCursor::End);
         n->setTextCursor(textCursor);
         QString comment = "// unknown library proc: ";
-        comment.append(ui->tblLibProcs->item(row, 0)->text());
+        comment.append(libProcText(row, LibProcModel::ColName));
         comment.append("\n");
         n->insertPlainText(comment);
     }
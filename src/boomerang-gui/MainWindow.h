@@ -23,7 +23,12 @@
 class QToolButton;
 class QTreeWidgetItem;
 class QTableWidgetItem;
+class QModelIndex;
+class QSortFilterProxyModel;
 class Decompiler;
+class LibProcModel;
+class ProcTreeModel;
+class UserProcModel;
 
 
 namespace Ui
@@ -75,13 +80,12 @@ public slots:
     void showRTLEditor(const QString &name);
 
     void on_twModuleTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
-    void on_twProcTree_itemDoubleClicked(QTreeWidgetItem *item, int column);
+    void on_twProcTree_doubleClicked(const QModelIndex &index);
     void on_actDebugEnabled_toggled(bool b);
     void on_actDebugStep_triggered();
     void onUserProcsHorizontalHeaderSectionClicked(int logicalIndex);
-    void on_tblUserProcs_cellDoubleClicked(int row, int column);
-    void on_tblUserProcs_cellChanged(int row, int column);
-    void on_tblLibProcs_cellDoubleClicked(int row, int column);
+    void on_tblUserProcs_doubleClicked(const QModelIndex &index);
+    void on_tblLibProcs_doubleClicked(const QModelIndex &index);
     void on_actNewProject_triggered();
     void on_actSaveProject_triggered();
     void on_actCloseProject_triggered();
@@ -128,6 +132,12 @@ private:
     QThread m_decompilerThread;
     Decompiler *m_decompiler = nullptr;
 
+    UserProcModel *m_userProcs               = nullptr;
+    LibProcModel *m_libProcs                 = nullptr;
+    ProcTreeModel *m_procTree                = nullptr;
+    QSortFilterProxyModel *m_sortedUserProcs = nullptr;
+    QSortFilterProxyModel *m_sortedLibProcs  = nullptr;
+
     bool m_loadingSettings   = false;
     int m_numDecompiledProcs = 0;
     int m_numCodeGenProcs    = 0;
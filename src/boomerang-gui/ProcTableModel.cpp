@@ -0,0 +1,79 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProcTableModel.h"
+
+
+/// Maximum delay in milliseconds until new rows become visible
+static const int FLUSH_DELAY = 100;
+
+
+ProcTableModel::ProcTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(FLUSH_DELAY);
+    connect(&m_flushTimer, &QTimer::timeout, this, &ProcTableModel::flush);
+}
+
+
+int ProcTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_numVisibleRows;
+}
+
+
+void ProcTableModel::clear()
+{
+    beginResetModel();
+    m_flushTimer.stop();
+    clearData();
+    m_numVisibleRows = 0;
+    endResetModel();
+}
+
+
+void ProcTableModel::flush()
+{
+    m_flushTimer.stop();
+
+    const int numRows = getNumDataRows();
+    if (numRows <= m_numVisibleRows) {
+        return;
+    }
+
+    beginInsertRows(QModelIndex(), m_numVisibleRows, numRows - 1);
+    m_numVisibleRows = numRows;
+    endInsertRows();
+}
+
+
+void ProcTableModel::rowsAppended()
+{
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+
+void ProcTableModel::beginRemoveDataRow(int row)
+{
+    if (isRowVisible(row)) {
+        beginRemoveRows(QModelIndex(), row, row);
+    }
+}
+
+
+void ProcTableModel::endRemoveDataRow(int row)
+{
+    if (isRowVisible(row)) {
+        m_numVisibleRows--;
+        endRemoveRows();
+    }
+}
@@ -0,0 +1,63 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QAbstractTableModel>
+#include <QTimer>
+
+
+/**
+ * Base class for the tables of procedures.
+ *
+ * New rows are appended to the data of the derived class immediately,
+ * but become visible to the views in batches: either when \ref flush is called,
+ * or at the latest after a short delay. This way the views are not updated
+ * for every single procedure that is discovered during decoding.
+ */
+class ProcTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    explicit ProcTableModel(QObject *parent = nullptr);
+
+public:
+    /// \copydoc QAbstractTableModel::rowCount
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// Remove all rows.
+    void clear();
+
+public slots:
+    /// Make all pending rows visible to the views.
+    void flush();
+
+protected:
+    /// \returns the number of rows in the data of the derived class, including pending rows.
+    virtual int getNumDataRows() const = 0;
+
+    /// Remove all rows from the data of the derived class.
+    virtual void clearData() = 0;
+
+    /// Must be called after rows were appended to the data of the derived class.
+    void rowsAppended();
+
+    /// \returns true if the row \p row is visible to the views.
+    bool isRowVisible(int row) const { return row < m_numVisibleRows; }
+
+    /// Must be called before and after removing the row \p row from the data.
+    void beginRemoveDataRow(int row);
+    void endRemoveDataRow(int row);
+
+private:
+    int m_numVisibleRows = 0;
+    QTimer m_flushTimer;
+};
@@ -0,0 +1,174 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProcTreeModel.h"
+
+#include <QColor>
+
+
+ProcTreeModel::ProcTreeModel(QObject *parent)
+    : QAbstractItemModel(parent)
+{
+}
+
+
+ProcTreeModel::~ProcTreeModel()
+{
+}
+
+
+QModelIndex ProcTreeModel::addProc(const QString &calledBy, const QString &name)
+{
+    if (m_nodeByName.contains(name)) {
+        return QModelIndex();
+    }
+
+    Node *parentNode = &m_root;
+
+    if (!calledBy.isEmpty()) {
+        parentNode = m_nodeByName.value(calledBy, nullptr);
+
+        if (!parentNode) {
+            return QModelIndex();
+        }
+    }
+
+    const int row = static_cast<int>(parentNode->children.size());
+
+    std::unique_ptr<Node> node(new Node);
+    node->name   = name;
+    node->parent = parentNode;
+    node->row    = row;
+
+    beginInsertRows(indexOf(parentNode), row, row);
+    m_nodeByName.insert(name, node.get());
+    parentNode->children.push_back(std::move(node));
+    endInsertRows();
+
+    return index(row, 0, indexOf(parentNode));
+}
+
+
+QModelIndex ProcTreeModel::setDecompiling(const QString &name)
+{
+    Node *node = m_nodeByName.value(name, nullptr);
+    if (!node) {
+        return QModelIndex();
+    }
+
+    node->decompiling     = true;
+    const QModelIndex idx = indexOf(node);
+    emit dataChanged(idx, idx, { Qt::ForegroundRole });
+    return idx;
+}
+
+
+QModelIndex ProcTreeModel::findProc(const QString &name) const
+{
+    return indexOf(m_nodeByName.value(name, nullptr));
+}
+
+
+QString ProcTreeModel::getProcName(const QModelIndex &index) const
+{
+    const Node *node = getNode(index);
+    return node != &m_root ? node->name : QString();
+}
+
+
+void ProcTreeModel::clear()
+{
+    beginResetModel();
+    m_nodeByName.clear();
+    m_root.children.clear();
+    endResetModel();
+}
+
+
+QModelIndex ProcTreeModel::index(int row, int column, const QModelIndex &parent) const
+{
+    const Node *parentNode = getNode(parent);
+
+    if (column != 0 || row < 0 || row >= static_cast<int>(parentNode->children.size())) {
+        return QModelIndex();
+    }
+
+    return createIndex(row, column, parentNode->children[row].get());
+}
+
+
+QModelIndex ProcTreeModel::parent(const QModelIndex &child) const
+{
+    const Node *node = getNode(child);
+    return node != &m_root ? indexOf(node->parent) : QModelIndex();
+}
+
+
+int ProcTreeModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.column() > 0) {
+        return 0;
+    }
+
+    return static_cast<int>(getNode(parent)->children.size());
+}
+
+
+int ProcTreeModel::columnCount(const QModelIndex &) const
+{
+    return 1;
+}
+
+
+QVariant ProcTreeModel::data(const QModelIndex &index, int role) const
+{
+    const Node *node = getNode(index);
+    if (node == &m_root) {
+        return QVariant();
+    }
+
+    if (role == Qt::DisplayRole) {
+        return node->name;
+    }
+    else if (role == Qt::ForegroundRole && node->decompiling) {
+        return QColor("blue");
+    }
+
+    return QVariant();
+}
+
+
+QVariant ProcTreeModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (section == 0 && orientation == Qt::Horizontal && role == Qt::DisplayRole) {
+        return tr("Name");
+    }
+
+    return QVariant();
+}
+
+
+ProcTreeModel::Node *ProcTreeModel::getNode(const QModelIndex &index) const
+{
+    if (!index.isValid()) {
+        return const_cast<Node *>(&m_root);
+    }
+
+    return static_cast<Node *>(index.internalPointer());
+}
+
+
+QModelIndex ProcTreeModel::indexOf(Node *node) const
+{
+    if (!node || node == &m_root) {
+        return QModelIndex();
+    }
+
+    return createIndex(node->row, 0, node);
+}
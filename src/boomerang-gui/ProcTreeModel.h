@@ -0,0 +1,92 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+
+/**
+ * Call tree of the procedures that are considered for decompilation.
+ * Each procedure appears at most once in the tree; nodes are indexed by name.
+ */
+class ProcTreeModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    explicit ProcTreeModel(QObject *parent = nullptr);
+    ~ProcTreeModel() override;
+
+public:
+    /**
+     * Add the procedure \p name as a child of \p calledBy,
+     * or as a top level procedure if \p calledBy is empty.
+     * \returns the index of the new node, or an invalid index if \p name is already in the tree
+     * or \p calledBy is not.
+     */
+    QModelIndex addProc(const QString &calledBy, const QString &name);
+
+    /// Mark the procedure \p name as being decompiled.
+    /// \returns the index of the procedure, or an invalid index if it is not in the tree.
+    QModelIndex setDecompiling(const QString &name);
+
+    /// \returns the index of the procedure \p name, or an invalid index if it is not in the tree.
+    QModelIndex findProc(const QString &name) const;
+
+    /// \returns the name of the procedure at \p index.
+    QString getProcName(const QModelIndex &index) const;
+
+    /// Remove all procedures.
+    void clear();
+
+public:
+    /// \copydoc QAbstractItemModel::index
+    QModelIndex index(int row, int column,
+                      const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::parent
+    QModelIndex parent(const QModelIndex &child) const override;
+
+    /// \copydoc QAbstractItemModel::rowCount
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractItemModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractItemModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+private:
+    struct Node
+    {
+        QString name;
+        Node *parent     = nullptr;
+        int row          = 0; ///< index of this node in the children of \ref parent
+        bool decompiling = false;
+        std::vector<std::unique_ptr<Node>> children;
+    };
+
+    Node *getNode(const QModelIndex &index) const;
+    QModelIndex indexOf(Node *node) const;
+
+private:
+    Node m_root;
+    QHash<QString, Node *> m_nodeByName;
+};
@@ -0,0 +1,219 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "UserProcModel.h"
+
+
+UserProcModel::UserProcModel(QObject *parent)
+    : ProcTableModel(parent)
+{
+}
+
+
+bool UserProcModel::addProc(const QString &name, Address addr)
+{
+    if (m_rowByName.contains(name) || m_rowByAddr.contains(addr.value())) {
+        return false;
+    }
+
+    const int row = getNumProcs();
+    m_procs.push_back({ addr, name, true });
+    m_rowByName.insert(name, row);
+    m_rowByAddr.insert(addr.value(), row);
+
+    rowsAppended();
+    return true;
+}
+
+
+bool UserProcModel::removeProc(Address addr)
+{
+    auto it = m_rowByAddr.find(addr.value());
+    if (it == m_rowByAddr.end()) {
+        return false;
+    }
+
+    const int row = it.value();
+
+    beginRemoveDataRow(row);
+    m_rowByName.remove(m_procs[row].name);
+    m_rowByAddr.erase(it);
+    m_procs.erase(m_procs.begin() + row);
+
+    // rows after the removed one moved up
+    for (int i = row; i < getNumProcs(); i++) {
+        m_rowByName[m_procs[i].name]        = i;
+        m_rowByAddr[m_procs[i].addr.value()] = i;
+    }
+
+    endRemoveDataRow(row);
+    return true;
+}
+
+
+QString UserProcModel::getProcName(int row) const
+{
+    return (row >= 0 && row < getNumProcs()) ? m_procs[row].name : QString();
+}
+
+
+bool UserProcModel::isDebugEnabled(const QString &name) const
+{
+    auto it = m_rowByName.find(name);
+    return it == m_rowByName.end() || m_procs[it.value()].debug;
+}
+
+
+void UserProcModel::toggleDebugEnabled()
+{
+    for (Entry &entry : m_procs) {
+        entry.debug = !entry.debug;
+    }
+
+    if (m_debugColumnVisible && rowCount() > 0) {
+        emit dataChanged(index(0, ColDebug), index(rowCount() - 1, ColDebug),
+                         { Qt::CheckStateRole });
+    }
+}
+
+
+void UserProcModel::setDebugColumnVisible(bool visible)
+{
+    if (visible == m_debugColumnVisible) {
+        return;
+    }
+    else if (visible) {
+        beginInsertColumns(QModelIndex(), ColDebug, ColDebug);
+        m_debugColumnVisible = true;
+        endInsertColumns();
+    }
+    else {
+        beginRemoveColumns(QModelIndex(), ColDebug, ColDebug);
+        m_debugColumnVisible = false;
+        endRemoveColumns();
+    }
+}
+
+
+int UserProcModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return m_debugColumnVisible ? 3 : 2;
+}
+
+
+QVariant UserProcModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || !isRowVisible(index.row())) {
+        return QVariant();
+    }
+
+    const Entry &entry = m_procs[index.row()];
+
+    switch (index.column()) {
+    case ColAddress:
+        if (role == Qt::DisplayRole) {
+            return entry.addr.toString();
+        }
+        break;
+
+    case ColName:
+        if (role == Qt::DisplayRole || role == Qt::EditRole) {
+            return entry.name;
+        }
+        break;
+
+    case ColDebug:
+        if (role == Qt::CheckStateRole) {
+            return entry.debug ? Qt::Checked : Qt::Unchecked;
+        }
+        break;
+    }
+
+    return QVariant();
+}
+
+
+bool UserProcModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!index.isValid() || !isRowVisible(index.row())) {
+        return false;
+    }
+
+    Entry &entry = m_procs[index.row()];
+
+    if (index.column() == ColName && role == Qt::EditRole) {
+        const QString newName = value.toString();
+
+        if (newName == entry.name) {
+            return true;
+        }
+        else if (newName.isEmpty() || m_rowByName.contains(newName)) {
+            return false;
+        }
+
+        const QString oldName = entry.name;
+        m_rowByName.remove(oldName);
+        m_rowByName.insert(newName, index.row());
+        entry.name = newName;
+
+        emit dataChanged(index, index, { Qt::DisplayRole, Qt::EditRole });
+        emit procRenamed(oldName, newName);
+        return true;
+    }
+    else if (index.column() == ColDebug && role == Qt::CheckStateRole) {
+        entry.debug = (value.toInt() == Qt::Checked);
+        emit dataChanged(index, index, { Qt::CheckStateRole });
+        return true;
+    }
+
+    return false;
+}
+
+
+QVariant UserProcModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    switch (section) {
+    case ColAddress: return tr("Address");
+    case ColName: return tr("Name");
+    case ColDebug: return tr("Debug");
+    }
+
+    return QVariant();
+}
+
+
+Qt::ItemFlags UserProcModel::flags(const QModelIndex &index) const
+{
+    Qt::ItemFlags itemFlags = ProcTableModel::flags(index);
+
+    if (index.column() == ColName) {
+        itemFlags |= Qt::ItemIsEditable;
+    }
+    else if (index.column() == ColDebug) {
+        itemFlags |= Qt::ItemIsUserCheckable;
+    }
+
+    return itemFlags;
+}
+
+
+void UserProcModel::clearData()
+{
+    m_procs.clear();
+    m_rowByName.clear();
+    m_rowByAddr.clear();
+}
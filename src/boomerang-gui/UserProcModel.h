@@ -0,0 +1,103 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang-gui/ProcTableModel.h"
+
+#include "boomerang/util/Address.h"
+
+#include <QHash>
+#include <QString>
+
+#include <vector>
+
+
+/**
+ * Table of user procedures (address, name and debug flag).
+ * Procedures are indexed by name and by address.
+ */
+class UserProcModel : public ProcTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column
+    {
+        ColAddress = 0,
+        ColName    = 1,
+        ColDebug   = 2
+    };
+
+public:
+    explicit UserProcModel(QObject *parent = nullptr);
+
+public:
+    /// Add the procedure \p name at address \p addr.
+    /// \returns false if there already is a procedure with the same name or address.
+    bool addProc(const QString &name, Address addr);
+
+    /// Remove the procedure at address \p addr.
+    /// \returns false if there is no such procedure.
+    bool removeProc(Address addr);
+
+    /// \returns the number of procedures, including the ones not yet visible.
+    int getNumProcs() const { return static_cast<int>(m_procs.size()); }
+
+    /// \returns the name of the procedure in row \p row.
+    QString getProcName(int row) const;
+
+    /// \returns false if the procedure \p name exists and debugging is disabled for it.
+    bool isDebugEnabled(const QString &name) const;
+
+    /// Enable debugging for all procedures that have it disabled, and vice versa.
+    void toggleDebugEnabled();
+
+    /// Show or hide the debug column.
+    void setDebugColumnVisible(bool visible);
+
+signals:
+    /// Emitted when the user renamed procedure \p oldName to \p newName
+    void procRenamed(const QString &oldName, const QString &newName);
+
+public:
+    /// \copydoc QAbstractTableModel::columnCount
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+
+    /// \copydoc QAbstractTableModel::data
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::setData
+    bool setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+
+    /// \copydoc QAbstractTableModel::headerData
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    /// \copydoc QAbstractTableModel::flags
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+protected:
+    int getNumDataRows() const override { return getNumProcs(); }
+    void clearData() override;
+
+private:
+    struct Entry
+    {
+        Address addr;
+        QString name;
+        bool debug;
+    };
+
+    std::vector<Entry> m_procs;
+    QHash<QString, int> m_rowByName;
+    QHash<Address::value_type, int> m_rowByAddr;
+    bool m_debugColumnVisible = true;
+};
@@ -34,6 +34,7 @@
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/util/ByteUtil.h"
+#include "boomerang/util/Tracer.h"
 #include "boomerang/util/log/Log.h"
 
 
@@ -414,7 +415,10 @@ void CCodeGenerator::addPrototype(UserProc *proc)
 
 void CCodeGenerator::generateCode(UserProc *proc)
 {
+    TraceScope trace("codegen", proc->getName());
+
     m_lines.clear();
+    m_generatedFrags.clear();
     m_proc = proc;
 
     if (!proc->getCFG() || !proc->getEntryFragment()) {
@@ -28,7 +28,11 @@ ControlFlowAnalyzer::ControlFlowAnalyzer()
 
 void ControlFlowAnalyzer::structureCFG(ProcCFG *cfg)
 {
-    m_cfg = cfg;
+    m_cfg      = cfg;
+    m_analysis = cfg->getAnalysis();
+
+    m_info.assign(m_analysis->getNumFragments(), FragStructInfo());
+    m_extraInfo.clear();
 
     if (m_cfg->findRetFragment() == nullptr) {
         return;
@@ -48,14 +52,22 @@ void ControlFlowAnalyzer::structureCFG(ProcCFG *cfg)
 void ControlFlowAnalyzer::setTimeStamps()
 {
     // set the parenthesis for the nodes as well as setting the post-order ordering between the
-    // nodes
-    int time = 1;
+    // nodes. The depth first search from the entry fragment is shared with the data flow analysis;
+    // only the relative order of the stamps matters.
     m_postOrdering.clear();
+    m_postOrdering.reserve(m_analysis->getPostOrder().size());
+
+    for (FragIndex idx : m_analysis->getPostOrder()) {
+        FragStructInfo &fragInfo = m_info[idx];
 
-    updateLoopStamps(findEntryFragment(), time);
+        fragInfo.m_preOrderID     = static_cast<int>(m_analysis->getPreOrderNum(idx)) + 1;
+        fragInfo.m_postOrderID    = static_cast<int>(m_analysis->getPostOrderNum(idx)) + 1;
+        fragInfo.m_postOrderIndex = static_cast<int>(m_postOrdering.size());
+        m_postOrdering.push_back(m_analysis->idxToFrag(idx));
+    }
 
     // set the reverse parenthesis for the nodes
-    time = 1;
+    int time = 1;
     updateRevLoopStamps(findEntryFragment(), time);
 
     IRFragment *retNode = findExitFragment();
@@ -181,7 +193,8 @@ void ControlFlowAnalyzer::structConds()
 }
 
 
-void ControlFlowAnalyzer::determineLoopType(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::determineLoopType(const IRFragment *header,
+                                            const std::vector<bool> &loopNodes)
 {
     assert(getLatchNode(header));
 
@@ -217,7 +230,8 @@ void ControlFlowAnalyzer::determineLoopType(const IRFragment *header, bool *&loo
 }
 
 
-void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header,
+                                         const std::vector<bool> &loopNodes)
 {
     assert(getStructType(header) == StructType::Loop ||
            getStructType(header) == StructType::LoopCond);
@@ -306,7 +320,8 @@ void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header, bool *&loopNo
 }
 
 
-void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header,
+                                         std::vector<bool> &loopNodes)
 {
     // Traverse the ordering structure from the header to the latch node tagging the nodes
     // determined to be within the loop. These are nodes that satisfy the following:
@@ -334,6 +349,9 @@ void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header, bool *&loopNo
 
 void ControlFlowAnalyzer::structLoops()
 {
+    // maps each node to whether or not it is within the current loop
+    std::vector<bool> loopNodes;
+
     for (int i = m_postOrdering.size() - 1; i >= 0; i--) {
         const IRFragment *currFrag = m_postOrdering[i]; // the current node under investigation
         const IRFragment *latch    = nullptr;           // the latching node of the loop
@@ -364,12 +382,7 @@ void ControlFlowAnalyzer::structLoops()
             continue;
         }
 
-        // define the map that maps each node to whether or not it is within the current loop
-        bool *loopNodes = new bool[m_postOrdering.size()];
-
-        for (unsigned int j = 0; j < m_postOrdering.size(); j++) {
-            loopNodes[j] = false;
-        }
+        loopNodes.assign(m_postOrdering.size(), false);
 
         setLatchNode(currFrag, latch);
 
@@ -391,8 +404,6 @@ void ControlFlowAnalyzer::structLoops()
 
         // calculate the follow node of this loop
         findLoopFollow(currFrag, loopNodes);
-
-        delete[] loopNodes;
     }
 }
 
@@ -515,38 +526,10 @@ bool ControlFlowAnalyzer::isCaseOption(const IRFragment *frag) const
 
 bool ControlFlowAnalyzer::isAncestorOf(const IRFragment *frag, const IRFragment *other) const
 {
-    return (m_info[frag].m_preOrderID < m_info[other].m_preOrderID &&
-            m_info[frag].m_postOrderID > m_info[other].m_postOrderID) ||
-           (m_info[frag].m_revPreOrderID < m_info[other].m_revPreOrderID &&
-            m_info[frag].m_revPostOrderID > m_info[other].m_revPostOrderID);
-}
-
-
-void ControlFlowAnalyzer::updateLoopStamps(const IRFragment *frag, int &time)
-{
-    // timestamp the current node with the current time
-    // and set its traversed flag
-    setTravType(frag, TravType::DFS_LNum);
-    m_info[frag].m_preOrderID = time;
-
-    // recurse on unvisited children and set inedges for all children
-    for (const IRFragment *succ : frag->getSuccessors()) {
-        // set the in edge from this child to its parent (the current node)
-        // (not done here, might be a problem)
-        // outEdges[i]->inEdges.Add(this);
-
-        // recurse on this child if it hasn't already been visited
-        if (getTravType(succ) != TravType::DFS_LNum) {
-            updateLoopStamps(succ, ++time);
-        }
-    }
-
-    // set the the second loopStamp value
-    m_info[frag].m_postOrderID = ++time;
-
-    // add this node to the ordering structure as well as recording its position within the ordering
-    m_info[frag].m_postOrderIndex = static_cast<int>(m_postOrdering.size());
-    m_postOrdering.push_back(frag);
+    return (info(frag).m_preOrderID < info(other).m_preOrderID &&
+            info(frag).m_postOrderID > info(other).m_postOrderID) ||
+           (info(frag).m_revPreOrderID < info(other).m_revPreOrderID &&
+            info(frag).m_revPostOrderID > info(other).m_revPostOrderID);
 }
 
 
@@ -554,7 +537,7 @@ void ControlFlowAnalyzer::updateRevLoopStamps(const IRFragment *frag, int &time)
 {
     // timestamp the current node with the current time and set its traversed flag
     setTravType(frag, TravType::DFS_RNum);
-    m_info[frag].m_revPreOrderID = time;
+    info(frag).m_revPreOrderID = time;
 
     // recurse on the unvisited children in reverse order
     for (int i = frag->getNumSuccessors() - 1; i >= 0; i--) {
@@ -564,7 +547,7 @@ void ControlFlowAnalyzer::updateRevLoopStamps(const IRFragment *frag, int &time)
         }
     }
 
-    m_info[frag].m_revPostOrderID = ++time;
+    info(frag).m_revPostOrderID = ++time;
 }
 
 
@@ -582,7 +565,7 @@ void ControlFlowAnalyzer::updateRevOrder(const IRFragment *frag)
 
     // add this node to the ordering structure and record the post dom. order of this node as its
     // index within this ordering structure
-    m_info[frag].m_revPostOrderIndex = static_cast<int>(m_revPostOrdering.size());
+    info(frag).m_revPostOrderIndex = static_cast<int>(m_revPostOrdering.size());
     m_revPostOrdering.push_back(frag);
 }
 
@@ -596,7 +579,7 @@ void ControlFlowAnalyzer::setCaseHead(const IRFragment *frag, const IRFragment *
 
     // don't tag this node if it is the case header under investigation
     if (frag != head) {
-        m_info[frag].m_caseHead = head;
+        info(frag).m_caseHead = head;
     }
 
     // if this is a nested case header, then it's member nodes
@@ -628,52 +611,52 @@ void ControlFlowAnalyzer::setStructType(const IRFragment *frag, StructType struc
     // (i.e. switch, if-then, if-then-else etc.)
     if (structType == StructType::Cond) {
         if (frag->isType(FragType::Nway)) {
-            m_info[frag].m_conditionHeaderType = CondType::Case;
+            info(frag).m_conditionHeaderType = CondType::Case;
         }
         else if (getCondFollow(frag) == frag->getSuccessor(BELSE)) {
-            m_info[frag].m_conditionHeaderType = CondType::IfThen;
+            info(frag).m_conditionHeaderType = CondType::IfThen;
         }
         else if (getCondFollow(frag) == frag->getSuccessor(BTHEN)) {
-            m_info[frag].m_conditionHeaderType = CondType::IfElse;
+            info(frag).m_conditionHeaderType = CondType::IfElse;
         }
         else {
-            m_info[frag].m_conditionHeaderType = CondType::IfThenElse;
+            info(frag).m_conditionHeaderType = CondType::IfThenElse;
         }
     }
 
-    m_info[frag].m_structuringType = structType;
+    info(frag).m_structuringType = structType;
 }
 
 
 void ControlFlowAnalyzer::setUnstructType(const IRFragment *frag, UnstructType unstructType)
 {
-    assert((m_info[frag].m_structuringType == StructType::Cond ||
-            m_info[frag].m_structuringType == StructType::LoopCond) &&
-           m_info[frag].m_conditionHeaderType != CondType::Case);
-    m_info[frag].m_unstructuredType = unstructType;
+    assert((info(frag).m_structuringType == StructType::Cond ||
+            info(frag).m_structuringType == StructType::LoopCond) &&
+           info(frag).m_conditionHeaderType != CondType::Case);
+    info(frag).m_unstructuredType = unstructType;
 }
 
 
 UnstructType ControlFlowAnalyzer::getUnstructType(const IRFragment *frag) const
 {
-    assert((m_info[frag].m_structuringType == StructType::Cond ||
-            m_info[frag].m_structuringType == StructType::LoopCond));
+    assert((info(frag).m_structuringType == StructType::Cond ||
+            info(frag).m_structuringType == StructType::LoopCond));
     // fails when cenerating code for switches; not sure if actually needed TODO
     // assert(m_conditionHeaderType != CondType::Case);
 
-    return m_info[frag].m_unstructuredType;
+    return info(frag).m_unstructuredType;
 }
 
 
 void ControlFlowAnalyzer::setLoopType(const IRFragment *frag, LoopType l)
 {
     assert(getStructType(frag) == StructType::Loop || getStructType(frag) == StructType::LoopCond);
-    m_info[frag].m_loopHeaderType = l;
+    info(frag).m_loopHeaderType = l;
 
     // set the structured class (back to) just Loop if the loop type is PreTested OR it's PostTested
     // and is a single block loop
-    if ((m_info[frag].m_loopHeaderType == LoopType::PreTested) ||
-        ((m_info[frag].m_loopHeaderType == LoopType::PostTested) && (frag == getLatchNode(frag)))) {
+    if ((info(frag).m_loopHeaderType == LoopType::PreTested) ||
+        ((info(frag).m_loopHeaderType == LoopType::PostTested) && (frag == getLatchNode(frag)))) {
         setStructType(frag, StructType::Loop);
     }
 }
@@ -682,21 +665,21 @@ void ControlFlowAnalyzer::setLoopType(const IRFragment *frag, LoopType l)
 LoopType ControlFlowAnalyzer::getLoopType(const IRFragment *frag) const
 {
     assert(getStructType(frag) == StructType::Loop || getStructType(frag) == StructType::LoopCond);
-    return m_info[frag].m_loopHeaderType;
+    return info(frag).m_loopHeaderType;
 }
 
 
 void ControlFlowAnalyzer::setCondType(const IRFragment *frag, CondType condType)
 {
     assert(getStructType(frag) == StructType::Cond || getStructType(frag) == StructType::LoopCond);
-    m_info[frag].m_conditionHeaderType = condType;
+    info(frag).m_conditionHeaderType = condType;
 }
 
 
 CondType ControlFlowAnalyzer::getCondType(const IRFragment *frag) const
 {
     assert(getStructType(frag) == StructType::Cond || getStructType(frag) == StructType::LoopCond);
-    return m_info[frag].m_conditionHeaderType;
+    return info(frag).m_conditionHeaderType;
 }
 
 
@@ -704,24 +687,24 @@ bool ControlFlowAnalyzer::isFragInLoop(const IRFragment *frag, const IRFragment
                                        const IRFragment *latch) const
 {
     assert(getLatchNode(header) == latch);
-    assert(header == latch || ((m_info[header].m_preOrderID > m_info[latch].m_preOrderID &&
-                                m_info[latch].m_postOrderID > m_info[header].m_postOrderID) ||
-                               (m_info[header].m_preOrderID < m_info[latch].m_preOrderID &&
-                                m_info[latch].m_postOrderID < m_info[header].m_postOrderID)));
+    assert(header == latch || ((info(header).m_preOrderID > info(latch).m_preOrderID &&
+                                info(latch).m_postOrderID > info(header).m_postOrderID) ||
+                               (info(header).m_preOrderID < info(latch).m_preOrderID &&
+                                info(latch).m_postOrderID < info(header).m_postOrderID)));
 
     // this node is in the loop if it is the latch node OR
     // this node is within the header and the latch is within this when using the forward loop
     // stamps OR this node is within the header and the latch is within this when using the reverse
     // loop stamps
     return frag == latch ||
-           (m_info[header].m_preOrderID < m_info[frag].m_preOrderID &&
-            m_info[frag].m_postOrderID < m_info[header].m_postOrderID &&
-            m_info[frag].m_preOrderID < m_info[latch].m_preOrderID &&
-            m_info[latch].m_postOrderID < m_info[frag].m_postOrderID) ||
-           (m_info[header].m_revPreOrderID < m_info[frag].m_revPreOrderID &&
-            m_info[frag].m_revPostOrderID < m_info[header].m_revPostOrderID &&
-            m_info[frag].m_revPreOrderID < m_info[latch].m_revPreOrderID &&
-            m_info[latch].m_revPostOrderID < m_info[frag].m_revPostOrderID);
+           (info(header).m_preOrderID < info(frag).m_preOrderID &&
+            info(frag).m_postOrderID < info(header).m_postOrderID &&
+            info(frag).m_preOrderID < info(latch).m_preOrderID &&
+            info(latch).m_postOrderID < info(frag).m_postOrderID) ||
+           (info(header).m_revPreOrderID < info(frag).m_revPreOrderID &&
+            info(frag).m_revPostOrderID < info(header).m_revPostOrderID &&
+            info(frag).m_revPreOrderID < info(latch).m_revPreOrderID &&
+            info(latch).m_revPostOrderID < info(frag).m_revPostOrderID);
 }
 
 
@@ -734,7 +717,11 @@ bool ControlFlowAnalyzer::hasBackEdge(const IRFragment *frag) const
 
 void ControlFlowAnalyzer::unTraverse()
 {
-    for (auto &elem : m_info) {
+    for (FragStructInfo &fragInfo : m_info) {
+        fragInfo.m_travType = TravType::Untraversed;
+    }
+
+    for (auto &elem : m_extraInfo) {
         elem.second.m_travType = TravType::Untraversed;
     }
 }
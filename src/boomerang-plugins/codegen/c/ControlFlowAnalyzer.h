@@ -10,7 +10,10 @@
 #pragma once
 
 
+#include "boomerang/db/proc/CFGAnalysis.h"
+
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -155,55 +158,58 @@ public:
 
     inline const IRFragment *getLatchNode(const IRFragment *frag) const
     {
-        return m_info[frag].m_latchNode;
+        return info(frag).m_latchNode;
     }
 
     inline const IRFragment *getLoopHead(const IRFragment *frag) const
     {
-        return m_info[frag].m_loopHead;
+        return info(frag).m_loopHead;
     }
 
     inline const IRFragment *getLoopFollow(const IRFragment *frag) const
     {
-        return m_info[frag].m_loopFollow;
+        return info(frag).m_loopFollow;
     }
 
     inline const IRFragment *getCondFollow(const IRFragment *frag) const
     {
-        return m_info[frag].m_condFollow;
+        return info(frag).m_condFollow;
     }
 
     inline const IRFragment *getCaseHead(const IRFragment *frag) const
     {
-        return m_info[frag].m_caseHead;
+        return info(frag).m_caseHead;
     }
 
-    TravType getTravType(const IRFragment *frag) const { return m_info[frag].m_travType; }
-    StructType getStructType(const IRFragment *frag) const
-    {
-        return m_info[frag].m_structuringType;
-    }
+    TravType getTravType(const IRFragment *frag) const { return info(frag).m_travType; }
+    StructType getStructType(const IRFragment *frag) const { return info(frag).m_structuringType; }
     CondType getCondType(const IRFragment *frag) const;
     UnstructType getUnstructType(const IRFragment *frag) const;
     LoopType getLoopType(const IRFragment *frag) const;
 
-    void setTravType(const IRFragment *frag, TravType type) { m_info[frag].m_travType = type; }
+    void setTravType(const IRFragment *frag, TravType type) { info(frag).m_travType = type; }
     void setStructType(const IRFragment *frag, StructType s);
 
     bool isCaseOption(const IRFragment *frag) const;
 
 private:
-    void updateLoopStamps(const IRFragment *frag, int &time);
+    /// \returns the structuring information of \p frag.
+    FragStructInfo &info(const IRFragment *frag) const
+    {
+        const FragIndex idx = m_analysis ? m_analysis->fragToIdx(frag) : INDEX_INVALID;
+        return idx != INDEX_INVALID ? m_info[idx] : m_extraInfo[frag];
+    }
+
     void updateRevLoopStamps(const IRFragment *frag, int &time);
     void updateRevOrder(const IRFragment *frag);
 
     void setLoopHead(const IRFragment *frag, const IRFragment *head)
     {
-        m_info[frag].m_loopHead = head;
+        info(frag).m_loopHead = head;
     }
     void setLatchNode(const IRFragment *frag, const IRFragment *latch)
     {
-        m_info[frag].m_latchNode = latch;
+        info(frag).m_latchNode = latch;
     }
 
     void setCaseHead(const IRFragment *frag, const IRFragment *head, const IRFragment *follow);
@@ -214,12 +220,12 @@ private:
 
     void setLoopFollow(const IRFragment *frag, const IRFragment *follow)
     {
-        m_info[frag].m_loopFollow = follow;
+        info(frag).m_loopFollow = follow;
     }
 
     void setCondFollow(const IRFragment *frag, const IRFragment *follow)
     {
-        m_info[frag].m_condFollow = follow;
+        info(frag).m_condFollow = follow;
     }
 
     /// establish if this fragment is the source of any back edges leading FROM it
@@ -230,14 +236,14 @@ private:
     bool isFragInLoop(const IRFragment *frag, const IRFragment *header,
                       const IRFragment *latch) const;
 
-    int getPostOrdering(const IRFragment *frag) const { return m_info[frag].m_postOrderIndex; }
-    int getRevOrd(const IRFragment *frag) const { return m_info[frag].m_revPostOrderIndex; }
+    int getPostOrdering(const IRFragment *frag) const { return info(frag).m_postOrderIndex; }
+    int getRevOrd(const IRFragment *frag) const { return info(frag).m_revPostOrderIndex; }
 
-    const IRFragment *getImmPDom(const IRFragment *frag) const { return m_info[frag].m_immPDom; }
+    const IRFragment *getImmPDom(const IRFragment *frag) const { return info(frag).m_immPDom; }
 
     void setImmPDom(const IRFragment *frag, const IRFragment *immPDom)
     {
-        m_info[frag].m_immPDom = immPDom;
+        info(frag).m_immPDom = immPDom;
     }
 
     void unTraverse();
@@ -274,16 +280,16 @@ private:
 
     /// \pre  The loop induced by (head,latch) has already had all its member nodes tagged
     /// \post The type of loop has been deduced
-    void determineLoopType(const IRFragment *header, bool *&loopNodes);
+    void determineLoopType(const IRFragment *header, const std::vector<bool> &loopNodes);
 
     /// \pre  The loop headed by header has been induced and all it's member nodes have been tagged
     /// \post The follow of the loop has been determined.
-    void findLoopFollow(const IRFragment *header, bool *&loopNodes);
+    void findLoopFollow(const IRFragment *header, const std::vector<bool> &loopNodes);
 
     /// \pre header has been detected as a loop header and has the details of the
     ///        latching node
     /// \post the nodes within the loop have been tagged
-    void tagNodesInLoop(const IRFragment *header, bool *&loopNodes);
+    void tagNodesInLoop(const IRFragment *header, std::vector<bool> &loopNodes);
 
     IRFragment *findEntryFragment() const;
     IRFragment *findExitFragment() const;
@@ -291,6 +297,9 @@ private:
 private:
     ProcCFG *m_cfg = nullptr;
 
+    /// Fragment numbering and depth first search of m_cfg, shared with the data flow analysis.
+    std::shared_ptr<const CFGAnalysis> m_analysis;
+
     /// Post Ordering according to a DFS starting at the entry fragment.
     std::vector<const IRFragment *> m_postOrdering;
 
@@ -300,7 +309,12 @@ private:
     std::vector<const IRFragment *> m_revPostOrdering;
 
 private:
-    /// mutable to allow using the map in const methods (might create entries).
+    /// Structuring information of all fragments of m_cfg, indexed by fragment index.
+    /// mutable to allow using it in const methods.
     /// DO NOT change FragStructInfo in const methods!
-    mutable std::unordered_map<const IRFragment *, FragStructInfo> m_info;
+    mutable std::vector<FragStructInfo> m_info;
+
+    /// Structuring information of fragments that are not part of m_cfg (e.g. nullptr).
+    /// mutable to allow using the map in const methods (might create entries).
+    mutable std::unordered_map<const IRFragment *, FragStructInfo> m_extraInfo;
 };
@@ -13,7 +13,6 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
-#include "boomerang/db/Prog.h"
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Binary.h"
 #include "boomerang/ssl/statements/CaseStatement.h"
@@ -25,6 +24,8 @@ CapstoneDecoder::CapstoneDecoder(Project *project, cs::cs_arch arch, cs::cs_mode
     : IDecoder(project)
     , m_dict(project->getSettings()->debugDecoder)
     , m_debugMode(project->getSettings()->debugDecoder)
+    , m_arch(arch)
+    , m_mode(mode)
 {
     cs::cs_open(arch, mode, &m_handle);
     cs::cs_option(m_handle, cs::CS_OPT_DETAIL, cs::CS_OPT_ON);
@@ -52,13 +53,23 @@ CapstoneDecoder::~CapstoneDecoder()
 }
 
 
-bool CapstoneDecoder::initialize(Project *project)
+bool CapstoneDecoder::initialize(Project *)
 {
-    m_prog = project->getProg();
     return true;
 }
 
 
+void CapstoneDecoder::setMode(cs::cs_mode mode)
+{
+    m_mode = mode;
+    cs::cs_option(m_handle, cs::CS_OPT_MODE, mode);
+
+    // existing contexts still use the old mode
+    std::lock_guard<std::mutex> lock(m_contextMutex);
+    m_freeContexts.clear();
+}
+
+
 bool CapstoneDecoder::isInstructionInGroup(const cs::cs_insn *instruction, uint8_t group) const
 {
     for (int i = 0; i < instruction->detail->groups_count; i++) {
@@ -69,3 +80,104 @@ bool CapstoneDecoder::isInstructionInGroup(const cs::cs_insn *instruction, uint8
 
     return false;
 }
+
+
+uint32 CapstoneDecoder::addTemplate(const QString &templateName) const
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_templateMutex);
+
+        QHash<QString, uint32>::const_iterator it = m_templatesByName.constFind(templateName);
+        if (it != m_templatesByName.constEnd()) {
+            return it.value();
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_templateMutex);
+
+    // another thread might have registered the template in the meantime
+    QHash<QString, uint32>::const_iterator it = m_templatesByName.constFind(templateName);
+    if (it != m_templatesByName.constEnd()) {
+        return it.value();
+    }
+
+    const uint32 templateID = static_cast<uint32>(m_templates.size());
+    m_templates.push_back({ templateName, QString(templateName).remove(".").toUpper() });
+    m_templatesByName.insert(templateName, templateID);
+
+    return templateID;
+}
+
+
+QString CapstoneDecoder::getTemplateNameByID(uint32 templateID) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_templateMutex);
+    return m_templates[templateID].m_name;
+}
+
+
+QString CapstoneDecoder::getDictName(const MachineInstruction &insn) const
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_templateMutex);
+
+        if (insn.m_templateID < m_templates.size() &&
+            m_templates[insn.m_templateID].m_name == insn.m_templateName) {
+            return m_templates[insn.m_templateID].m_dictName;
+        }
+    }
+
+    // Instruction was not created by this decoder
+    return QString(insn.m_templateName).remove(".").toUpper();
+}
+
+
+std::unique_ptr<CapstoneDecoder::DisasmContext> CapstoneDecoder::acquireContext() const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_contextMutex);
+
+        if (!m_freeContexts.empty()) {
+            std::unique_ptr<DisasmContext> context = std::move(m_freeContexts.back());
+            m_freeContexts.pop_back();
+            return context;
+        }
+    }
+
+    return std::make_unique<DisasmContext>(m_arch, m_mode);
+}
+
+
+void CapstoneDecoder::releaseContext(std::unique_ptr<DisasmContext> context) const
+{
+    std::lock_guard<std::mutex> lock(m_contextMutex);
+    m_freeContexts.push_back(std::move(context));
+}
+
+
+CapstoneDecoder::DisasmContext::DisasmContext(cs::cs_arch arch, cs::cs_mode mode)
+{
+    cs::cs_open(arch, mode, &m_handle);
+    cs::cs_option(m_handle, cs::CS_OPT_DETAIL, cs::CS_OPT_ON);
+    m_insn = cs::cs_malloc(m_handle);
+}
+
+
+CapstoneDecoder::DisasmContext::~DisasmContext()
+{
+    cs::cs_free(m_insn, 1);
+    cs::cs_close(&m_handle);
+}
+
+
+CapstoneDecoder::ContextLease::ContextLease(const CapstoneDecoder *decoder)
+    : m_decoder(decoder)
+    , m_context(decoder->acquireContext())
+{
+}
+
+
+CapstoneDecoder::ContextLease::~ContextLease()
+{
+    m_decoder->releaseContext(std::move(m_context));
+}
@@ -13,6 +13,13 @@
 #include "boomerang/ifc/IDecoder.h"
 #include "boomerang/ssl/RTLInstDict.h"
 
+#include <QHash>
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
 
 namespace cs
 {
@@ -22,9 +29,42 @@ namespace cs
 
 /**
  * Base class for instruction decoders using Capstone for disassembling instructions.
+ *
+ * Capstone handles and instruction buffers must not be used by more than one thread
+ * at a time. Therefore, each disassembly leases a \ref DisasmContext from a pool owned by
+ * the decoder; the remaining state (SSL dictionary, template tables) is shared between threads.
  */
 class CapstoneDecoder : public IDecoder
 {
+protected:
+    /// Per-thread Capstone state needed to disassemble instructions.
+    struct DisasmContext
+    {
+        DisasmContext(cs::cs_arch arch, cs::cs_mode mode);
+        ~DisasmContext();
+
+        cs::csh m_handle;
+        cs::cs_insn *m_insn = nullptr; ///< buffer for the decoded instruction
+    };
+
+    /// Leases a disassembly context of \p decoder for the lifetime of this object.
+    class ContextLease
+    {
+    public:
+        explicit ContextLease(const CapstoneDecoder *decoder);
+        ContextLease(const ContextLease &) = delete;
+        ~ContextLease();
+
+        ContextLease &operator=(const ContextLease &) = delete;
+
+    public:
+        DisasmContext *operator->() const { return m_context.get(); }
+
+    private:
+        const CapstoneDecoder *m_decoder;
+        std::unique_ptr<DisasmContext> m_context;
+    };
+
 public:
     /**
      * \param project the project that holds the program being decompiled.
@@ -46,11 +86,48 @@ public:
 protected:
     bool initialize(Project *project) override;
 
+    /// Changes the disassembly mode of all contexts created from now on.
+    /// Must not be called while instructions are being disassembled.
+    void setMode(cs::cs_mode mode);
+
     bool isInstructionInGroup(const cs::cs_insn *instruction, uint8_t group) const;
 
+    /**
+     * Registers the SSL template \p templateName.
+     * \returns the ID of the template. Registering the same name twice returns the same ID.
+     */
+    uint32 addTemplate(const QString &templateName) const;
+
+    /// \returns the name of the template with ID \p templateID (e.g. MOVSX.r32.rm8)
+    QString getTemplateNameByID(uint32 templateID) const;
+
+    /// \returns the name of the template of \p insn as used by the SSL dictionary
+    /// (i.e. in upper case and without dots, e.g. MOVSXR32RM8)
+    QString getDictName(const MachineInstruction &insn) const;
+
+private:
+    std::unique_ptr<DisasmContext> acquireContext() const;
+    void releaseContext(std::unique_ptr<DisasmContext> context) const;
+
 protected:
-    cs::csh m_handle;
-    Prog *m_prog = nullptr;
+    cs::csh m_handle; ///< Only used for queries that do not depend on a decoded instruction
     RTLInstDict m_dict;
     bool m_debugMode = false;
+
+private:
+    struct TemplateInfo
+    {
+        QString m_name;     ///< Name as produced by the decoder
+        QString m_dictName; ///< Name as used by the SSL dictionary
+    };
+
+    cs::cs_arch m_arch;
+    cs::cs_mode m_mode;
+
+    mutable std::mutex m_contextMutex;
+    mutable std::vector<std::unique_ptr<DisasmContext>> m_freeContexts; ///< Contexts not in use
+
+    mutable std::shared_mutex m_templateMutex;        ///< Guards the template tables
+    mutable std::vector<TemplateInfo> m_templates;    ///< All registered templates, indexed by ID
+    mutable QHash<QString, uint32> m_templatesByName; ///< Template name -> template ID
 };
@@ -11,7 +11,6 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/plugin/Plugin.h"
-#include "boomerang/db/Prog.h"
 #include "boomerang/ssl/exp/Binary.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
@@ -138,14 +137,6 @@ CapstoneX86Decoder::CapstoneX86Decoder(Project *project)
     if (m_dict.getRegDB()->getRegNameByNum(REG_X86_ESP).isEmpty()) {
         throw std::runtime_error("Required register #28 (%esp) not present");
     }
-
-    m_insn = cs::cs_malloc(m_handle);
-}
-
-
-CapstoneX86Decoder::~CapstoneX86Decoder()
-{
-    cs::cs_free(m_insn, 1);
 }
 
 
@@ -157,9 +148,9 @@ bool CapstoneX86Decoder::initialize(Project *project)
 
     const int bitness = project->getLoadedBinaryFile()->getBitness();
     switch (bitness) {
-    case 16: cs::cs_option(m_handle, cs::CS_OPT_MODE, cs::CS_MODE_16); break;
-    case 32: cs::cs_option(m_handle, cs::CS_OPT_MODE, cs::CS_MODE_32); break;
-    case 64: cs::cs_option(m_handle, cs::CS_OPT_MODE, cs::CS_MODE_64); break;
+    case 16: setMode(cs::CS_MODE_16); break;
+    case 32: setMode(cs::CS_MODE_32); break;
+    case 64: setMode(cs::CS_MODE_64); break;
     default: return false;
     }
 
@@ -168,41 +159,46 @@ bool CapstoneX86Decoder::initialize(Project *project)
 
 
 bool CapstoneX86Decoder::disassembleInstruction(Address pc, ptrdiff_t delta,
-                                                MachineInstruction &result)
+                                                MachineInstruction &result) const
 {
     const Byte *instructionData = reinterpret_cast<const Byte *>((HostAddress(delta) + pc).value());
     size_t size                 = X86_MAX_INSTRUCTION_LENGTH;
     uint64 addr                 = pc.value();
 
-    const bool valid = cs_disasm_iter(m_handle, &instructionData, &size, &addr, m_insn);
+    ContextLease context(this);
+    const cs::cs_insn *insn = context->m_insn;
+
+    const bool valid = cs_disasm_iter(context->m_handle, &instructionData, &size, &addr,
+                                      context->m_insn);
 
     if (!valid) {
         return false;
     }
 
-    result.m_addr = Address(m_insn->address);
-    result.m_id   = m_insn->id;
-    result.m_size = m_insn->size;
+    result.m_addr = Address(insn->address);
+    result.m_id   = insn->id;
+    result.m_size = insn->size;
 
-    std::strncpy(result.m_mnem.data(), m_insn->mnemonic, MNEM_SIZE);
-    std::strncpy(result.m_opstr.data(), m_insn->op_str, OPSTR_SIZE);
+    std::strncpy(result.m_mnem.data(), insn->mnemonic, MNEM_SIZE);
+    std::strncpy(result.m_opstr.data(), insn->op_str, OPSTR_SIZE);
     result.m_mnem[MNEM_SIZE - 1]   = '\0';
     result.m_opstr[OPSTR_SIZE - 1] = '\0';
 
-    const std::size_t numOperands = m_insn->detail->x86.op_count;
+    const std::size_t numOperands = insn->detail->x86.op_count;
     result.m_operands.resize(numOperands);
 
     for (std::size_t i = 0; i < numOperands; ++i) {
-        result.m_operands[i] = operandToExp(m_insn->detail->x86.operands[i]);
+        result.m_operands[i] = operandToExp(insn->detail->x86.operands[i]);
     }
 
-    result.m_templateName = getTemplateName(m_insn);
+    result.m_templateID   = getTemplateID(insn);
+    result.m_templateName = getTemplateNameByID(result.m_templateID);
 
-    result.setGroup(MIGroup::Jump, isInstructionInGroup(m_insn, cs::CS_GRP_JUMP));
-    result.setGroup(MIGroup::Call, isInstructionInGroup(m_insn, cs::CS_GRP_CALL));
+    result.setGroup(MIGroup::Jump, isInstructionInGroup(insn, cs::CS_GRP_JUMP));
+    result.setGroup(MIGroup::Call, isInstructionInGroup(insn, cs::CS_GRP_CALL));
     result.setGroup(MIGroup::BoolAsgn, result.m_templateName.startsWith("SET"));
-    result.setGroup(MIGroup::Ret, isInstructionInGroup(m_insn, cs::CS_GRP_RET) ||
-                                      isInstructionInGroup(m_insn, cs::CS_GRP_IRET));
+    result.setGroup(MIGroup::Ret, isInstructionInGroup(insn, cs::CS_GRP_RET) ||
+                                      isInstructionInGroup(insn, cs::CS_GRP_IRET));
 
     if (result.isInGroup(MIGroup::Jump) || result.isInGroup(MIGroup::Call)) {
         assert(result.getNumOperands() > 0);
@@ -213,7 +209,8 @@ bool CapstoneX86Decoder::disassembleInstruction(Address pc, ptrdiff_t delta,
 }
 
 
-bool CapstoneX86Decoder::liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted)
+bool CapstoneX86Decoder::liftInstruction(const MachineInstruction &insn,
+                                         LiftedInstruction &lifted) const
 {
     if (insn.m_id == cs::X86_INS_BSF || insn.m_id == cs::X86_INS_BSR) {
         // special hack to give BSF/BSR the correct semantics since SSL does not support loops yet
@@ -231,7 +228,7 @@ bool CapstoneX86Decoder::liftInstruction(const MachineInstruction &insn, LiftedI
     }
     // clang-format on
     else {
-        lifted.addPart(createRTLForInstruction(insn));
+        lifted.addPart(createRTLForInstruction(insn, lifted));
     }
 
     return lifted.getFirstRTL() != nullptr;
@@ -257,7 +254,8 @@ static const QString operandNames[] = {
     "rm",  // X86_OP_MEM
 };
 
-std::unique_ptr<RTL> CapstoneX86Decoder::createRTLForInstruction(const MachineInstruction &insn)
+std::unique_ptr<RTL> CapstoneX86Decoder::createRTLForInstruction(const MachineInstruction &insn,
+                                                                 LiftedInstruction &lifted) const
 {
     const QString insnID     = insn.m_templateName;
     std::unique_ptr<RTL> rtl = instantiateRTL(insn);
@@ -283,13 +281,7 @@ std::unique_ptr<RTL> CapstoneX86Decoder::createRTLForInstruction(const MachineIn
                     rtl->erase(std::next(it).base());
                 }
                 else {
-                    Function *destProc = m_prog->getOrCreateFunction(destAddr);
-
-                    if (destProc == reinterpret_cast<Function *>(-1)) {
-                        destProc = nullptr;
-                    }
-
-                    call->setDestProc(destProc);
+                    lifted.requestCallee(call);
                 }
             }
         }
@@ -419,10 +411,9 @@ std::unique_ptr<RTL> CapstoneX86Decoder::createRTLForInstruction(const MachineIn
 }
 
 
-std::unique_ptr<RTL> CapstoneX86Decoder::instantiateRTL(const MachineInstruction &insn)
+std::unique_ptr<RTL> CapstoneX86Decoder::instantiateRTL(const MachineInstruction &insn) const
 {
-    // Take the argument, convert it to upper case and remove any .'s
-    const QString sanitizedName   = QString(insn.m_templateName).remove(".").toUpper();
+    const QString sanitizedName   = getDictName(insn);
     const std::size_t numOperands = insn.getNumOperands();
 
     if (m_debugMode) {
@@ -441,7 +432,7 @@ std::unique_ptr<RTL> CapstoneX86Decoder::instantiateRTL(const MachineInstruction
 }
 
 
-bool CapstoneX86Decoder::genBSFR(const MachineInstruction &insn, LiftedInstruction &result)
+bool CapstoneX86Decoder::genBSFR(const MachineInstruction &insn, LiftedInstruction &result) const
 {
     // Note the horrible hack needed here. We need initialisation code, and an extra branch, so the
     // %SKIP/%RPT won't work. We need to emit 6 statements, but these need to be in 3 RTLs, since
@@ -546,6 +537,50 @@ bool CapstoneX86Decoder::genBSFR(const MachineInstruction &insn, LiftedInstructi
 }
 
 
+uint32 CapstoneX86Decoder::getTemplateID(const cs::cs_insn *instruction) const
+{
+    const int numOperands         = instruction->detail->x86.op_count;
+    const cs::cs_x86_op *operands = instruction->detail->x86.operands;
+
+    // Shape key layout: bits 0-15: instruction ID; bits 16-17: REP/REPNE prefix;
+    // followed by 11 bits per operand (3 bits operand type, 8 bits operand size).
+    // Shapes that do not fit into the key are not cached.
+    const bool cacheable = numOperands <= 4 && instruction->id <= 0xFFFF;
+
+    if (!cacheable) {
+        return addTemplate(getTemplateName(instruction));
+    }
+
+    uint64 key = instruction->id;
+
+    switch (instruction->detail->x86.prefix[0]) {
+    case cs::X86_PREFIX_REP: key |= 1ULL << 16; break;
+    case cs::X86_PREFIX_REPNE: key |= 2ULL << 16; break;
+    }
+
+    for (int i = 0; i < numOperands; i++) {
+        const uint64 opShape = (static_cast<uint64>(operands[i].type) & 0x7) |
+                               (static_cast<uint64>(operands[i].size) << 3);
+        key |= opShape << (18 + 11 * i);
+    }
+
+    {
+        std::shared_lock<std::shared_mutex> lock(m_shapeMutex);
+
+        auto it = m_templateIDsByShape.find(key);
+        if (it != m_templateIDsByShape.end()) {
+            return it->second;
+        }
+    }
+
+    const uint32 templateID = addTemplate(getTemplateName(instruction));
+
+    std::unique_lock<std::shared_mutex> lock(m_shapeMutex);
+    m_templateIDsByShape.insert({ key, templateID });
+    return templateID;
+}
+
+
 QString CapstoneX86Decoder::getTemplateName(const cs::cs_insn *instruction) const
 {
     const int numOperands         = instruction->detail->x86.op_count;
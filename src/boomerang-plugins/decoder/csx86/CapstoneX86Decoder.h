@@ -15,6 +15,9 @@
 #include "boomerang/core/BoomerangAPI.h"
 #include "boomerang/ssl/exp/Operator.h"
 
+#include <shared_mutex>
+#include <unordered_map>
+
 
 /**
  * Instruction decoder using Capstone to decode
@@ -24,14 +27,14 @@ class BOOMERANG_PLUGIN_API CapstoneX86Decoder : public CapstoneDecoder
 {
 public:
     CapstoneX86Decoder(Project *project);
-    ~CapstoneX86Decoder();
 
 public:
     /// \copydoc IDecoder::decodeInstruction
-    bool disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result) override;
+    bool disassembleInstruction(Address pc, ptrdiff_t delta,
+                                MachineInstruction &result) const override;
 
     /// \copydoc IDecoder::liftInstruction
-    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) override;
+    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) const override;
 
     /// \copydoc IDecoder::getRegNameByNum
     QString getRegNameByNum(RegNum regNum) const override;
@@ -44,14 +47,15 @@ private:
 
     /**
      * Creates a new RTL for a single instruction.
-     * \param pc the address of the instruction to instantiate.
-     * \param instruction the actual instruction.
+     * \param insn the instruction to instantiate.
+     * \param lifted receives the callees of static calls that need to be created.
      *
      * \internal Note that for some instruction groups (e.g. calls, jumps, setCC instructions)
      * hard-coded adjustments are performed due to SSL limitations. See the function definition
      * for details.
      */
-    std::unique_ptr<RTL> createRTLForInstruction(const MachineInstruction &insn);
+    std::unique_ptr<RTL> createRTLForInstruction(const MachineInstruction &insn,
+                                                 LiftedInstruction &lifted) const;
 
     /**
      * Instantiates an RTL for a single instruction, replacing formal parameters with actual
@@ -62,7 +66,7 @@ private:
      * \param numOperands number of instruction operands (e.g. 2 for MOV.reg32.reg32)
      * \param operands Array containing actual arguments containing \p numOperands elements.
      */
-    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn);
+    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn) const;
 
     /**
      * Generate statements for the BSF and BSR instructions (Bit Scan Forward/Reverse)
@@ -71,11 +75,18 @@ private:
      * instrucion to generate the correct semantics.
      * \param pc start of the instruction
      */
-    bool genBSFR(const MachineInstruction &insn, LiftedInstruction &result);
+    bool genBSFR(const MachineInstruction &insn, LiftedInstruction &result) const;
+
+    /// \returns the ID of the SSL template for \p instruction
+    uint32 getTemplateID(const cs::cs_insn *instruction) const;
 
     /// \returns the name of the SSL template for \p instruction
     QString getTemplateName(const cs::cs_insn *instruction) const;
 
 private:
-    cs::cs_insn *m_insn; ///< decoded instruction;
+    mutable std::shared_mutex m_shapeMutex; ///< Guards m_templateIDsByShape
+
+    /// Maps instruction shapes (instruction ID, prefix, operand types and sizes)
+    /// to template IDs, so the template name is only built once per shape.
+    mutable std::unordered_map<uint64, uint32> m_templateIDsByShape;
 };
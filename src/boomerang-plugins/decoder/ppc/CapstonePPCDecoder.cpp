@@ -10,7 +10,6 @@
 #include "CapstonePPCDecoder.h"
 
 #include "boomerang/core/plugin/Plugin.h"
-#include "boomerang/db/Prog.h"
 #include "boomerang/ssl/statements/BranchStatement.h"
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/CaseStatement.h"
@@ -91,14 +90,17 @@ CapstonePPCDecoder::CapstonePPCDecoder(Project *project)
 
 
 bool CapstonePPCDecoder::disassembleInstruction(Address pc, ptrdiff_t delta,
-                                                MachineInstruction &result)
+                                                MachineInstruction &result) const
 {
     const Byte *instructionData = reinterpret_cast<const Byte *>((HostAddress(delta) + pc).value());
+    size_t size                 = PPC_INSN_LENGTH;
+    uint64 addr                 = pc.value();
 
-    cs::cs_insn *decodedInstruction;
-    size_t numInstructions = cs_disasm(m_handle, instructionData, PPC_INSN_LENGTH, pc.value(), 1,
-                                       &decodedInstruction);
-    const bool valid       = numInstructions > 0;
+    ContextLease context(this);
+    cs::cs_insn *decodedInstruction = context->m_insn;
+
+    const bool valid = cs_disasm_iter(context->m_handle, &instructionData, &size, &addr,
+                                      decodedInstruction);
 
     if (!valid) {
         return false;
@@ -134,20 +136,21 @@ bool CapstonePPCDecoder::disassembleInstruction(Address pc, ptrdiff_t delta,
         result.m_operands[i] = operandToExp(decodedInstruction->detail->ppc.operands[i]);
     }
 
-    result.m_templateName = getTemplateName(decodedInstruction);
+    result.m_templateID   = getTemplateID(decodedInstruction);
+    result.m_templateName = getTemplateNameByID(result.m_templateID);
 
     result.setGroup(MIGroup::Call, isCall(decodedInstruction));
     result.setGroup(MIGroup::Jump, isJump(decodedInstruction));
     result.setGroup(MIGroup::Ret, isRet(decodedInstruction));
 
-    cs_free(decodedInstruction, numInstructions);
     return true;
 }
 
 
-bool CapstonePPCDecoder::liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted)
+bool CapstonePPCDecoder::liftInstruction(const MachineInstruction &insn,
+                                         LiftedInstruction &lifted) const
 {
-    lifted.addPart(createRTLForInstruction(insn));
+    lifted.addPart(createRTLForInstruction(insn, lifted));
 
     return lifted.getFirstRTL() != nullptr;
 }
@@ -165,7 +168,8 @@ int CapstonePPCDecoder::getRegSizeByNum(RegNum regNum) const
 }
 
 
-std::unique_ptr<RTL> CapstonePPCDecoder::createRTLForInstruction(const MachineInstruction &insn)
+std::unique_ptr<RTL> CapstonePPCDecoder::createRTLForInstruction(const MachineInstruction &insn,
+                                                                 LiftedInstruction &lifted) const
 {
     std::unique_ptr<RTL> rtl = instantiateRTL(insn);
 
@@ -185,12 +189,7 @@ std::unique_ptr<RTL> CapstonePPCDecoder::createRTLForInstruction(const MachineIn
                                              Const::get(insn.m_addr + PPC_INSN_LENGTH)));
         rtl->append(callStmt);
 
-        if (m_prog) {
-            Function *callee = m_prog->getOrCreateFunction(callDest);
-            if (callee && callee != reinterpret_cast<Function *>(-1)) {
-                callStmt->setDestProc(callee);
-            }
-        }
+        lifted.requestCallee(callStmt);
     }
     else if (insnID == "BCTR") {
         std::shared_ptr<CaseStatement> jump(new CaseStatement(Location::regOf(REG_PPC_CTR)));
@@ -321,7 +320,7 @@ std::unique_ptr<RTL> CapstonePPCDecoder::createRTLForInstruction(const MachineIn
 }
 
 
-std::unique_ptr<RTL> CapstonePPCDecoder::instantiateRTL(const MachineInstruction &insn)
+std::unique_ptr<RTL> CapstonePPCDecoder::instantiateRTL(const MachineInstruction &insn) const
 {
     if (m_debugMode) {
         QString argNames;
@@ -335,9 +334,7 @@ std::unique_ptr<RTL> CapstonePPCDecoder::instantiateRTL(const MachineInstruction
         LOG_MSG("Instantiating RTL at %1: %2 %3", insn.m_addr, insn.m_templateName, argNames);
     }
 
-    // Take the argument, convert it to upper case and remove any .'s
-    const QString sanitizedName = QString(insn.m_templateName).remove(".").toUpper();
-    return m_dict.instantiateRTL(sanitizedName, insn.m_addr, insn.m_operands);
+    return m_dict.instantiateRTL(getDictName(insn), insn.m_addr, insn.m_operands);
 }
 
 
@@ -362,6 +359,29 @@ bool CapstonePPCDecoder::isCRManip(const cs::cs_insn *instruction) const
 }
 
 
+uint32 CapstonePPCDecoder::getTemplateID(const cs::cs_insn *instruction) const
+{
+    // The template name only depends on the mnemonic.
+    // Mnemonics are short enough for the small string optimization, so this does not allocate.
+    const std::string mnem = instruction->mnemonic;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mnemMutex);
+
+        auto it = m_templateIDsByMnem.find(mnem);
+        if (it != m_templateIDsByMnem.end()) {
+            return it->second;
+        }
+    }
+
+    const uint32 templateID = addTemplate(getTemplateName(instruction));
+
+    std::unique_lock<std::shared_mutex> lock(m_mnemMutex);
+    m_templateIDsByMnem.insert({ mnem, templateID });
+    return templateID;
+}
+
+
 QString CapstonePPCDecoder::getTemplateName(const cs::cs_insn *instruction) const
 {
     QString insnID = instruction->mnemonic; // cs::cs_insn_name(m_handle, instruction->id);
@@ -15,6 +15,10 @@
 #include "boomerang/core/BoomerangAPI.h"
 #include "boomerang/ssl/exp/Operator.h"
 
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
 
 /**
  * Instruction decoder using Capstone to decode
@@ -27,10 +31,11 @@ public:
 
 public:
     /// \copydoc IDecoder::decodeInstruction
-    bool disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result) override;
+    bool disassembleInstruction(Address pc, ptrdiff_t delta,
+                                MachineInstruction &result) const override;
 
     /// \copydoc IDecoder::liftInstruction
-    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) override;
+    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) const override;
 
     /// \copydoc IDecoder::getRegNameByNum
     QString getRegNameByNum(RegNum regNum) const override;
@@ -39,9 +44,10 @@ public:
     int getRegSizeByNum(RegNum regNum) const override;
 
 private:
-    std::unique_ptr<RTL> createRTLForInstruction(const MachineInstruction &insn);
+    std::unique_ptr<RTL> createRTLForInstruction(const MachineInstruction &insn,
+                                                 LiftedInstruction &lifted) const;
 
-    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn);
+    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn) const;
 
     /// \returns true if the instruction is a CR manipulation instruction, e.g. crxor
     bool isCRManip(const cs::cs_insn *instruction) const;
@@ -52,6 +58,16 @@ private:
 
     bool isRet(const cs::cs_insn *instruction) const;
 
+    /// \returns the ID of the SSL template for \p instruction
+    uint32 getTemplateID(const cs::cs_insn *instruction) const;
+
     /// \returns the name of the SSL template for \p instruction
     QString getTemplateName(const cs::cs_insn *instruction) const;
+
+private:
+    mutable std::shared_mutex m_mnemMutex; ///< Guards m_templateIDsByMnem
+
+    /// Maps instruction mnemonics to template IDs,
+    /// so the template name is only built once per mnemonic.
+    mutable std::unordered_map<std::string, uint32> m_templateIDsByMnem;
 };
@@ -65,6 +65,7 @@ static const char *functionNames[] = {
 ST20Decoder::ST20Decoder(Project *project)
     : IDecoder(project)
     , m_rtlDict(project->getSettings()->debugDecoder)
+    , m_debugMode(project->getSettings()->debugDecoder)
 {
     const Settings *settings = project->getSettings();
     QString realSSLFileName;
@@ -83,14 +84,14 @@ ST20Decoder::ST20Decoder(Project *project)
 }
 
 
-bool ST20Decoder::initialize(Project *project)
+bool ST20Decoder::initialize(Project *)
 {
-    m_prog = project->getProg();
     return true;
 }
 
 
-bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result)
+bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta,
+                                         MachineInstruction &result) const
 {
     bool valid    = false; //< Is this a valid instruction?
     int total     = 0;     // Total value from all prefixes
@@ -217,7 +218,7 @@ bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta, MachineIns
 }
 
 
-bool ST20Decoder::liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted)
+bool ST20Decoder::liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) const
 {
     lifted.addPart(instantiateRTL(insn));
 
@@ -403,13 +404,13 @@ const char *ST20Decoder::getInstructionName(int prefixTotal) const
 }
 
 
-std::unique_ptr<RTL> ST20Decoder::instantiateRTL(const MachineInstruction &insn)
+std::unique_ptr<RTL> ST20Decoder::instantiateRTL(const MachineInstruction &insn) const
 {
     // Take the argument, convert it to upper case and remove any .'s
     const QString sanitizedName = QString(insn.m_templateName).remove(".").toUpper();
 
     // Display a disassembly of this instruction if requested
-    if (m_prog && m_prog->getProject()->getSettings()->debugDecoder) {
+    if (m_debugMode) {
         QString msg{ insn.m_addr.toString() + " " + insn.m_templateName + " " };
 
         for (const SharedExp &itd : insn.m_operands) {
@@ -46,10 +46,11 @@ public:
 
 public:
     /// \copydoc IDecoder::decodeInstruction
-    bool disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result) override;
+    bool disassembleInstruction(Address pc, ptrdiff_t delta,
+                                MachineInstruction &result) const override;
 
     /// \copydoc IDecoder::liftInstruction
-    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) override;
+    bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) const override;
 
 private:
     /**
@@ -65,7 +66,7 @@ private:
      * \param   args Semantic String ptrs representing actual operands
      * \returns an instantiated list of Exps
      */
-    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn);
+    std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn) const;
 
     /// \param prefixTotal The sum of all prefixes
     /// \returns the name of an instruction determined by its prefixes (e.g. 0x53 -> mul)
@@ -75,5 +76,5 @@ private:
     /// Dictionary of instruction patterns, and other information summarised from the SSL file
     /// (e.g. source machine's endianness)
     RTLInstDict m_rtlDict;
-    Prog *m_prog = nullptr;
+    bool m_debugMode = false;
 };
@@ -59,7 +59,7 @@ bool X86FrontEnd::liftProcImpl(UserProc *proc)
     processStringInst(proc);
 
     IRFragment::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     ProcCFG *procCFG = proc->getCFG();
 
     for (IRFragment *frag : *procCFG) {
@@ -321,7 +321,7 @@ void X86FrontEnd::processStringInst(UserProc *proc)
 void X86FrontEnd::processOverlapped(UserProc *proc)
 {
     // first, lets look for any uses of the registers
-    std::set<RegNum> usedRegs;
+    RegNumSet usedRegs;
     StatementList stmts;
     proc->getStatements(stmts);
 
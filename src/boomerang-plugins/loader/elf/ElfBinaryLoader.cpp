@@ -583,6 +583,8 @@ void ElfBinaryLoader::addSymbolsForSection(int secIndex)
     const int numSymbols = section.Size / section.entry_size;
     QString fileName;
 
+    m_symbols->reserve(m_symbols->size() + numSymbols);
+
     // Index 0 is a dummy entry
     for (int i = 1; i < numSymbols; i++) {
         Translated_ElfSym translatedSym;
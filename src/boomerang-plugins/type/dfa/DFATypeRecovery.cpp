@@ -64,11 +64,11 @@ DFATypeRecovery::DFATypeRecovery(Project *project)
 }
 
 
-void DFATypeRecovery::printResults(StatementList &stmts, int iter)
+void DFATypeRecovery::printResults(const StatementRange &stmts, int iter)
 {
     LOG_VERBOSE("%1 iterations", iter);
 
-    for (SharedStmt s : stmts) {
+    for (const SharedStmt &s : stmts) {
         LOG_VERBOSE("%1", s); // Print the statement; has dest type
 
         // Now print type for each constant in this Statement
@@ -247,16 +247,15 @@ void DFATypeRecovery::dfaTypeAnalysis(UserProc *proc)
 
     // First use the type information from the signature.
     // Sometimes needed to split variables
-    bool ch = dfaTypeAnalysis(proc->getSignature().get(), cfg);
-    StatementList stmts;
-    proc->getStatements(stmts);
+    bool ch                    = dfaTypeAnalysis(proc->getSignature().get(), cfg);
+    const StatementRange stmts = proc->getStatements();
 
     int iter = 0;
 
     for (iter = 1; iter <= DFA_ITER_LIMIT; ++iter) {
         ch = false;
 
-        for (SharedStmt stmt : stmts) {
+        for (const SharedStmt &stmt : stmts) {
             SharedStmt before = nullptr;
 
             if (proc->getProg()->getProject()->getSettings()->debugTA) {
@@ -300,7 +299,8 @@ void DFATypeRecovery::dfaTypeAnalysis(UserProc *proc)
     Prog *_prog = proc->getProg();
     DataIntervalMap localsMap(proc); // map of all local variables of proc
 
-    for (SharedStmt s : stmts) {
+    // Implicit assignments might be replaced below, so iterate over a snapshot.
+    for (const SharedStmt &s : stmts.snapshot()) {
         // 1) constants
         std::list<std::shared_ptr<Const>> constList;
         findConstantsInStmt(s, constList);
@@ -529,7 +529,7 @@ bool DFATypeRecovery::doEllipsisProcessing(UserProc *proc)
 
     for (IRFragment *frag : *proc->getCFG()) {
         IRFragment::RTLRIterator rrit;
-        StatementList::reverse_iterator srit;
+        RTL::reverse_iterator srit;
         std::shared_ptr<CallStatement> c = std::dynamic_pointer_cast<CallStatement>(
             frag->getLastStmt(rrit, srit));
 
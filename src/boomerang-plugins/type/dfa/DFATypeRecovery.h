@@ -20,7 +20,7 @@
 
 class ProcCFG;
 class Signature;
-class StatementList;
+class StatementRange;
 class UserProc;
 class Const;
 
@@ -55,7 +55,7 @@ private:
     bool dfaTypeAnalysis(Signature *signature, ProcCFG *cfg);
     //     bool dfaTypeAnalysis(const SharedStmt &stmt);
 
-    void printResults(StatementList &stmts, int iter);
+    void printResults(const StatementRange &stmts, int iter);
 
     /// Replace array references of the form m[idx*K1 + K2]
     /// in \p s. Create global array variables as needed.
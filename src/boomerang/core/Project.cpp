@@ -12,11 +12,13 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/core/Watcher.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/binary/BinarySymbol.h"
 #include "boomerang/db/binary/BinarySymbolTable.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/decomp/ProgDecompiler.h"
 #include "boomerang/util/CallGraphDotWriter.h"
 #include "boomerang/util/ProgSymbolWriter.h"
+#include "boomerang/util/Tracer.h"
 #include "boomerang/util/log/Log.h"
 
 
@@ -106,6 +108,7 @@ const char *Project::getVersionStr() const
 
 bool Project::loadBinaryFile(const QString &filePath)
 {
+    TraceScope trace("phase", "load");
     LOG_MSG("Loading binary file '%1'", filePath);
 
     // Find loader plugin to load file
@@ -177,14 +180,21 @@ bool Project::decodeBinaryFile()
         return false;
     }
 
+    TraceScope trace("phase", "decode");
     loadSymbols();
 
-    if (!getSettings()->m_entryPoints.empty()) { // decode only specified procs
+    const bool hasScopeRoots = getSettings()->m_scope.hasRootFilter();
+
+    if (!getSettings()->m_entryPoints.empty() || hasScopeRoots) { // decode only specified procs
         // decode entry points from -e (and -E) switch(es)
         for (auto &elem : getSettings()->m_entryPoints) {
             LOG_MSG("Decoding specified entrypoint at address %1", elem);
             m_prog->decodeEntryPoint(elem);
         }
+
+        if (hasScopeRoots) {
+            decodeScopeRoots();
+        }
     }
     else if (!decodeAll()) { // decode everything
         return false;
@@ -217,6 +227,7 @@ bool Project::decompileBinaryFile()
         return false;
     }
 
+    TraceScope trace("phase", "decompile");
     LOG_MSG("Decompiling...");
     ProgDecompiler dcomp(m_prog.get());
     dcomp.decompile();
@@ -236,6 +247,7 @@ bool Project::generateCode(Module *module)
         return false;
     }
 
+    TraceScope trace("phase", "codegen");
     LOG_MSG("Generating code...");
     for (auto &plugin : m_pluginManager->getPluginsByType(PluginType::CodeGenerator)) {
         ICodeGenerator *gen = plugin->getIfc<ICodeGenerator>();
@@ -313,6 +325,40 @@ void Project::loadSymbols()
 }
 
 
+void Project::decodeScopeRoots()
+{
+    const DecompilationScope &scope = getSettings()->m_scope;
+    std::vector<Address> roots;
+
+    for (const BinarySymbol *sym : *m_loadedBinary->getSymbols()) {
+        const Address addr = sym->getLocation();
+
+        if (sym->isImported() || addr < m_prog->getLimitTextLow() ||
+            addr >= m_prog->getLimitTextHigh()) {
+            continue;
+        }
+        else if (scope.isRoot(addr, sym->getName())) {
+            roots.push_back(addr);
+        }
+    }
+
+    if (roots.empty()) {
+        LOG_WARN("No procedure of the binary file is in the decompilation scope");
+        return;
+    }
+
+    for (Address addr : roots) {
+        LOG_MSG("Decoding procedure at address %1 in decompilation scope", addr);
+        m_prog->decodeEntryPoint(addr);
+    }
+
+    // Procedures in the scope found while decoding the ones above
+    if (getSettings()->decodeChildren && !m_fe->disassembleAll()) {
+        LOG_WARN("Could not decode all procedures in the decompilation scope");
+    }
+}
+
+
 bool Project::decodeAll()
 {
     if (getSettings()->decodeMain) {
@@ -204,6 +204,13 @@ private:
      */
     bool decodeAll();
 
+    /**
+     * Disassemble all procedures of the binary file selected by
+     * the address ranges and name patterns of the decompilation scope.
+     * Callees are disassembled on demand during decompilation.
+     */
+    void decodeScopeRoots();
+
 private:
     std::unique_ptr<Settings> m_settings;
 
@@ -11,6 +11,7 @@
 
 
 #include "boomerang/util/Address.h"
+#include "boomerang/util/DecompilationScope.h"
 
 #include <QDir>
 #include <QString>
@@ -82,6 +83,7 @@ public:
     bool generateSymbols   = false;
     bool useGlobals        = true;
     bool assumeABI         = false; ///< Assume ABI compliance
+    bool useIRArena        = false; ///< Allocate the IR of each proc from a per-proc memory pool
 
     QString replayFile;  ///< file with commands to execute in interactive mode
     QString sslFileName; ///< Use this SSL file instead of one of the hard-coded ones.
@@ -89,6 +91,9 @@ public:
     /// Contains all known entrypoints for the Prog.
     std::vector<Address> m_entryPoints;
 
+    /// Restricts decoding and decompilation to a part of the program.
+    DecompilationScope m_scope;
+
     /// A vector containing the names of all symbol files to load.
     std::vector<QString> m_symbolFiles;
 
@@ -40,29 +40,6 @@ DataFlow::~DataFlow()
 }
 
 
-void DataFlow::dfs(FragIndex myIdx, FragIndex parentIdx)
-{
-    assert(myIdx != INDEX_INVALID);
-    if (m_dfnum[myIdx] >= 0) {
-        // already visited
-        return;
-    }
-
-    m_dfnum[myIdx]  = N;
-    m_vertex[N]     = myIdx;
-    m_parent[myIdx] = parentIdx;
-
-    N++;
-
-    // Recurse to successors
-    IRFragment *frag = m_frags[myIdx];
-
-    for (IRFragment *succ : frag->getSuccessors()) {
-        dfs(m_indices[succ], myIdx);
-    }
-}
-
-
 bool DataFlow::calculateDominators()
 {
     ProcCFG *cfg               = m_proc->getCFG();
@@ -73,171 +50,17 @@ bool DataFlow::calculateDominators()
         return false; // nothing to do
     }
 
-    allocateData();
-    recalcSpanningTree();
-
-    assert(N >= 1);
-
-    // Process fragments in reverse pre-traversal order (i.e. return blocks first)
-    for (std::size_t i = N - 1; i >= 1; i--) {
-        FragIndex n = m_vertex[i];
-        FragIndex p = m_parent[n];
-        FragIndex s = p;
-
-        // These lines calculate the semi-dominator of n, based on the Semidominator Theorem
-        for (IRFragment *pred : m_frags[n]->getPredecessors()) {
-            if (m_indices.find(pred) == m_indices.end()) {
-                LOG_ERROR("Fragment not in indices: ", pred->toString());
-                return false;
-            }
-
-            const FragIndex v = m_indices[pred];
-            FragIndex sdash   = v;
-
-            if (isAncestorOf(v, n)) {
-                sdash = m_semi[getAncestorWithLowestSemi(v)];
-            }
-
-            if (isAncestorOf(s, sdash)) {
-                s = sdash;
-            }
-        }
-
-        m_semi[n] = s;
-
-        // Calculation of n's dominator is deferred until the path from s to n
-        // has been linked into the forest
-        m_bucket[s].insert(n);
-        link(p, n);
-
-        // for each v in bucket[p]
-        for (FragIndex v : m_bucket[p]) {
-            // Now that the path from p to v has been linked into the spanning forest,
-            // these lines calculate the dominator of v, based on the first clause of the
-            // Dominator Theorem, or else defer the calculation until y's dominator is known.
-            const FragIndex y = getAncestorWithLowestSemi(v);
-
-            if (m_semi[y] == m_semi[v]) {
-                m_idom[v] = p; // Success!
-            }
-            else {
-                m_samedom[v] = y; // Defer
-            }
-        }
-
-        m_bucket[p].clear();
-    }
-
-    for (std::size_t i = 1; i < N - 1; i++) {
-        // Now all the deferred dominator calculations, based on the second clause of the Dominator
-        // Theorem, are performed.
-        FragIndex n = m_vertex[i];
-
-        if (m_samedom[n] != INDEX_INVALID) {
-            m_idom[n] = m_idom[m_samedom[n]]; // Deferred success!
-        }
+    std::shared_ptr<const CFGAnalysis> analysis = cfg->getAnalysis();
+    if (!analysis->isValid()) {
+        return false;
     }
 
-    const FragIndex entryIndex = fragToIdx(entryFrag);
-    assert(entryIndex != INDEX_INVALID);
-
-    // the entry fragment is always executed.
-    m_idom[entryIndex] = entryIndex;
-    m_semi[entryIndex] = entryIndex;
-
-    computeDF(entryIndex); // Finally, compute the dominance frontiers
+    m_analysis = analysis;
+    allocateData();
     return true;
 }
 
 
-FragIndex DataFlow::getAncestorWithLowestSemi(FragIndex v)
-{
-    assert(v != INDEX_INVALID);
-
-    const FragIndex a = m_ancestor[v];
-    if (a != INDEX_INVALID && m_ancestor[a] != INDEX_INVALID) {
-        const FragIndex b = getAncestorWithLowestSemi(a);
-        m_ancestor[v]     = m_ancestor[a];
-
-        if (isAncestorOf(m_semi[m_best[v]], m_semi[b])) {
-            m_best[v] = b;
-        }
-    }
-
-    return m_best[v];
-}
-
-
-void DataFlow::link(FragIndex p, FragIndex n)
-{
-    assert(n != INDEX_INVALID);
-
-    m_ancestor[n] = p;
-    m_best[n]     = n;
-}
-
-
-bool DataFlow::doesDominate(FragIndex n, FragIndex w)
-{
-    assert(n != INDEX_INVALID);
-    assert(w != INDEX_INVALID);
-
-    while (w != INDEX_INVALID && m_idom[w] != w) {
-        if (m_idom[w] == n) {
-            return true;
-        }
-
-        w = m_idom[w]; // Move up the dominator tree
-    }
-
-    return false;
-}
-
-
-void DataFlow::computeDF(FragIndex n)
-{
-    assert(n != INDEX_INVALID);
-
-    std::set<FragIndex> S;
-    // This loop computes DF_local[n]
-    // for each node y in succ(n)
-    IRFragment *frag = m_frags[n];
-
-    for (IRFragment *succ : frag->getSuccessors()) {
-        FragIndex y = m_indices[succ];
-
-        if (m_idom[y] != n) {
-            S.insert(y);
-        }
-    }
-
-    // for each child c of n in the dominator tree
-    // Note: this is a linear search!
-    const size_t sz = m_idom.size(); // ? Was ancestor.size()
-
-    for (FragIndex c = FragIndex(0); c < sz; ++c) {
-        if (m_idom[c] != n) {
-            continue;
-        }
-        else if (c != n) { // do not calculate DF for entry fragment again
-            computeDF(c);
-        }
-
-        /* This loop computes DF_up[c] */
-        // for each element w of DF[c]
-        std::set<FragIndex> &s = m_DF[c];
-
-        for (FragIndex w : s) {
-            if (n == w || !doesDominate(n, w)) {
-                S.insert(w);
-            }
-        }
-    }
-
-    m_DF[n] = S;
-}
-
-
 bool DataFlow::canRename(SharedConstExp exp) const
 {
     if (exp->isSubscript()) {
@@ -275,15 +98,6 @@ bool DataFlow::canRename(SharedConstExp exp) const
 
 bool DataFlow::placePhiFunctions()
 {
-    // First free some memory no longer needed
-    m_dfnum.resize(0);
-    m_semi.resize(0);
-    m_ancestor.resize(0);
-    m_samedom.resize(0);
-    m_vertex.resize(0);
-    m_parent.resize(0);
-    m_best.resize(0);
-    m_bucket.resize(0);
     m_defsites.clear();
     m_defallsites.clear();
 
@@ -306,7 +120,7 @@ bool DataFlow::placePhiFunctions()
     }
 
     // Set the sizes of needed vectors
-    const std::size_t numIndices = m_indices.size();
+    const std::size_t numIndices = m_analysis->getNumFragments();
     const std::size_t numFrags   = m_proc->getCFG()->getNumFragments();
     assert(numIndices == numFrags);
     Q_UNUSED(numIndices);
@@ -319,8 +133,8 @@ bool DataFlow::placePhiFunctions()
     // Recreate each call because propagation and other changes make old data invalid
     for (FragIndex n{ 0 }; n < numFrags; ++n) {
         IRFragment::RTLIterator rit;
-        StatementList::iterator sit;
-        IRFragment *frag = m_frags[n];
+        RTL::iterator sit;
+        IRFragment *frag = idxToFrag(n);
 
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt;
              stmt            = frag->getNextStmt(rit, sit)) {
@@ -367,7 +181,7 @@ bool DataFlow::placePhiFunctions()
             const FragIndex n = *W.begin();
             W.erase(W.begin());
 
-            for (FragIndex y : m_DF[n]) {
+            for (FragIndex y : getDF(n)) {
                 // phi function already created for y?
                 if (m_A_phi[a].find(y) != m_A_phi[a].end()) {
                     continue;
@@ -375,7 +189,7 @@ bool DataFlow::placePhiFunctions()
 
                 // Insert trivial phi function for a at top of block y: a := phi()
                 change = true;
-                m_frags[y]->addPhi(a->clone());
+                idxToFrag(y)->addPhi(a->clone());
 
                 // A_phi[a] <- A_phi[a] U {y}
                 m_A_phi[a].insert(y);
@@ -434,56 +248,10 @@ void DataFlow::convertImplicits()
 
 void DataFlow::allocateData()
 {
-    ProcCFG *cfg               = m_proc->getCFG();
-    const std::size_t numFrags = cfg->getNumFragments();
-
-    m_frags.assign(numFrags, nullptr);
-    m_indices.clear();
-
-    m_dfnum.assign(numFrags, -1);
-    m_semi.assign(numFrags, INDEX_INVALID);
-    m_ancestor.assign(numFrags, INDEX_INVALID);
-    m_idom.assign(numFrags, INDEX_INVALID);
-    m_samedom.assign(numFrags, INDEX_INVALID);
-    m_vertex.assign(numFrags, INDEX_INVALID);
-    m_parent.assign(numFrags, INDEX_INVALID);
-    m_best.assign(numFrags, INDEX_INVALID);
-    m_bucket.assign(numFrags, {});
-    m_DF.assign(numFrags, {});
-    m_definedAt.assign(numFrags, {});
+    m_definedAt.assign(m_analysis->getNumFragments(), {});
 
     m_A_phi.clear();
     m_defsites.clear();
     m_defallsites.clear();
     m_defStmts.clear();
-
-    // Set up the fragment and indices vectors.
-    // Do this here because sometimes a fragment can be unreachable
-    // (so relying on in-edges doesn't work)
-    std::size_t i = 0;
-    for (IRFragment *frag : *cfg) {
-        m_frags[i++] = frag;
-    }
-
-    for (std::size_t j = 0; j < numFrags; j++) {
-        m_indices[m_frags[j]] = j;
-    }
-}
-
-
-void DataFlow::recalcSpanningTree()
-{
-    IRFragment *entryFrag = m_proc->getEntryFragment();
-    assert(entryFrag != nullptr);
-    const FragIndex entryIndex = fragToIdx(entryFrag);
-    assert(entryIndex != INDEX_INVALID);
-
-    N = 0;
-    dfs(entryIndex, INDEX_INVALID);
-}
-
-
-bool DataFlow::isAncestorOf(FragIndex n, FragIndex parent) const
-{
-    return m_dfnum[parent] < m_dfnum[n];
 }
@@ -10,19 +10,17 @@
 #pragma once
 
 
+#include "boomerang/db/proc/CFGAnalysis.h"
 #include "boomerang/ssl/statements/Statement.h"
 #include "boomerang/util/LocationSet.h"
 
 #include <map>
-#include <unordered_map>
+#include <memory>
 
 
 class IRFragment;
 class PhiAssign;
 
-typedef std::size_t FragIndex;
-static constexpr const FragIndex INDEX_INVALID = FragIndex(-1);
-
 
 /**
  * Dominator frontier code largely as per Appel 2002
@@ -44,9 +42,9 @@ public:
 
 public:
     /**
-     * Calculate dominators for every node n using Lengauer-Tarjan with path compression.
-     * Essentially Algorithm 19.9 of Appel's
-     * "Modern compiler implementation in Java" 2nd ed 2002
+     * Calculate dominators and dominance frontiers for every node n.
+     * The analysis is shared with other users of the CFG (see \ref ProcCFG::getAnalysis)
+     * and only recomputed if the CFG has changed.
      */
     bool calculateDominators();
 
@@ -79,7 +77,7 @@ public:
     std::set<const IRFragment *> getDominanceFrontier(const IRFragment *frag) const
     {
         std::set<const IRFragment *> ret;
-        for (FragIndex idx : m_DF.at(fragToIdx(frag))) {
+        for (FragIndex idx : getDF(fragToIdx(frag))) {
             ret.insert(idxToFrag(idx));
         }
 
@@ -87,38 +85,24 @@ public:
     }
 
 public:
-    const IRFragment *idxToFrag(FragIndex node) const { return m_frags.at(node); }
-    IRFragment *idxToFrag(FragIndex node) { return m_frags.at(node); }
+    const IRFragment *idxToFrag(FragIndex node) const { return m_analysis->idxToFrag(node); }
+    IRFragment *idxToFrag(FragIndex node) { return m_analysis->idxToFrag(node); }
+
+    FragIndex fragToIdx(const IRFragment *frag) const { return m_analysis->fragToIdx(frag); }
 
-    FragIndex fragToIdx(const IRFragment *frag) const
+    const std::set<FragIndex> &getDF(FragIndex node) const
     {
-        return m_indices.at(const_cast<IRFragment *>(frag));
+        return m_analysis->getDominanceFrontier(node);
     }
 
-    std::set<FragIndex> &getDF(FragIndex node) { return m_DF[node]; }
-    FragIndex getIdom(FragIndex node) const { return m_idom[node]; }
-    FragIndex getSemi(FragIndex node) const { return m_semi[node]; }
+    FragIndex getIdom(FragIndex node) const { return m_analysis->getIdom(node); }
+    FragIndex getSemi(FragIndex node) const { return m_analysis->getSemi(node); }
     std::set<FragIndex> &getA_phi(SharedExp e) { return m_A_phi[e]; }
 
-private:
-    void recalcSpanningTree();
-
-    /// depth first search
-    /// \param myIdx index of the current fragment
-    /// \param parentIdx index of the parent of the current fragment
-    void dfs(FragIndex myIdx, FragIndex parentIdx);
-
-    /// Basically algorithm 19.10b of Appel 2002 (uses path compression for O(log N) amortised time
-    /// per operation (overall O(N log N))
-    FragIndex getAncestorWithLowestSemi(FragIndex v);
-
-    void link(FragIndex p, FragIndex n);
-
-    void computeDF(FragIndex n);
-
-    /// \return true if \p n dominates \p w.
-    bool doesDominate(FragIndex n, FragIndex w);
+    /// \returns the analysis computed by the last call to \ref calculateDominators()
+    const CFGAnalysis *getAnalysis() const { return m_analysis.get(); }
 
+private:
     bool canRenameLocalsParams() const { return renameLocalsAndParams; }
 
     void clearA_phi() { m_A_phi.clear(); }
@@ -126,36 +110,13 @@ private:
 private:
     void allocateData();
 
-    bool isAncestorOf(FragIndex n, FragIndex parent) const;
-
 private:
     UserProc *m_proc = nullptr;
 
-    /* Dominance Frontier Data */
-
-    // These first two are not from Appel; they map fragments to indices and back
-    std::vector<IRFragment *> m_frags;                     ///< Maps index -> IRFragment
-    std::unordered_map<IRFragment *, FragIndex> m_indices; ///< Maps IRFragment -> index
-
-    /// Calculating the dominance frontier
-
-    /// Order number of fragment n during a depth first search.
-    /// If there is a path from a to b in the ProcCFG, then a is an ancestor of b
-    /// if dfnum[a] < dfnum[b]. If fragment a has not yet been visited, m_dfnum[a] will be -1.
-    std::vector<int> m_dfnum;
-
-    std::vector<FragIndex>
-        m_ancestor;                ///< Immediate unique ancestor in the depth first spanning tree
-    std::vector<FragIndex> m_semi; ///< Semi-dominator of n
-    std::vector<FragIndex> m_idom; ///< Immediate dominator
-
-    std::vector<FragIndex> m_samedom;          ///< ? To do with deferring
-    std::vector<FragIndex> m_vertex;           ///< ?
-    std::vector<FragIndex> m_parent;           ///< Parent in the dominator tree?
-    std::vector<FragIndex> m_best;             ///< Improves ancestorWithLowestSemi
-    std::vector<std::set<FragIndex>> m_bucket; ///< Deferred calculation?
-    std::vector<std::set<FragIndex>> m_DF;     ///< Dominance frontier for every node n
-    std::size_t N = 0;                         ///< Current node number in algorithm
+    /// Dominance Frontier Data.
+    /// Kept until the next call to \ref calculateDominators()
+    /// even if the CFG changes in the meantime.
+    std::shared_ptr<const CFGAnalysis> m_analysis;
 
     /*
      * Inserting phi-functions
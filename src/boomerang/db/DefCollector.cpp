@@ -14,6 +14,9 @@
 
 #include <QtAlgorithms>
 
+#include <algorithm>
+#include <vector>
+
 
 #define DEFCOL_COLS 120
 
@@ -30,12 +33,15 @@ void DefCollector::makeCloneOf(const DefCollector &other)
     for (const auto &elem : other) {
         m_defs.insert(elem->clone()->as<Assign>());
     }
+
+    m_numAtDefs = other.m_numAtDefs;
 }
 
 
 void DefCollector::clear()
 {
     m_defs.clear();
+    m_numAtDefs = 0;
 }
 
 
@@ -46,12 +52,29 @@ void DefCollector::collectDef(const std::shared_ptr<Assign> &a)
     }
 
     m_defs.insert(a);
+
+    if (a->getLeft()->getOper() == opAt) {
+        m_numAtDefs++;
+    }
 }
 
 
 bool DefCollector::hasDefOf(const SharedExp &e) const
 {
-    return m_defs.definesLoc(e);
+    if (!e) {
+        return false;
+    }
+    else if (m_defs.lookupLoc(e) != nullptr) {
+        return true;
+    }
+    else if (m_numAtDefs == 0) {
+        return false;
+    }
+
+    // foo@[x:y] also defines foo
+    return std::any_of(m_defs.begin(), m_defs.end(), [&e](const std::shared_ptr<Assign> &def) {
+        return def->getLeft()->getOper() == opAt && def->definesLoc(e);
+    });
 }
 
 
@@ -59,13 +82,8 @@ SharedExp DefCollector::findDefFor(const SharedExp &e) const
 {
     assert(e != nullptr);
 
-    for (std::shared_ptr<Assign> def : m_defs) {
-        if (*def->getLeft() == *e) {
-            return def->getRight();
-        }
-    }
-
-    return nullptr; // Not explicitly defined here
+    std::shared_ptr<Assign> def = m_defs.lookupLoc(e);
+    return def ? def->getRight() : nullptr; // nullptr: Not explicitly defined here
 }
 
 
@@ -86,11 +104,37 @@ void DefCollector::updateDefs(std::map<SharedExp, std::stack<SharedStmt>, lessEx
 }
 
 
-void DefCollector::searchReplaceAll(const Exp &from, SharedExp to, bool &changed)
+bool DefCollector::searchAndReplace(const Exp &pattern, SharedExp replacement, bool cc)
 {
-    for (auto def : m_defs) {
-        changed |= def->searchAndReplace(from, to);
+    bool change = false;
+
+    for (const std::shared_ptr<Assign> &def : m_defs) {
+        change |= def->searchAndReplace(pattern, replacement, cc);
+    }
+
+    if (!change) {
+        return false;
+    }
+
+    // The LHS of some definitions might have changed, which invalidates the sort order
+    const std::vector<std::shared_ptr<Assign>> defs(m_defs.begin(), m_defs.end());
+    m_defs.clear();
+
+    for (const std::shared_ptr<Assign> &def : defs) {
+        m_defs.insert(def);
     }
+
+    countAtDefs();
+    return true;
+}
+
+
+void DefCollector::countAtDefs()
+{
+    m_numAtDefs = std::count_if(m_defs.begin(), m_defs.end(),
+                                [](const std::shared_ptr<Assign> &def) {
+                                    return def->getLeft()->getOper() == opAt;
+                                });
 }
 
 
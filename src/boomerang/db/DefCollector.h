@@ -69,13 +69,21 @@ public:
     void updateDefs(std::map<SharedExp, std::stack<SharedStmt>, lessExpStar> &Stacks,
                     UserProc *proc);
 
-    /// Search and replace all occurrences
-    void searchReplaceAll(const Exp &pattern, SharedExp replacement, bool &change);
+    /// Search and replace all occurrences of \p pattern in the collected definitions.
+    /// Definitions whose LHS changed are re-sorted; if two definitions end up
+    /// with the same LHS, only one of them is kept.
+    /// \returns true if anything changed.
+    bool searchAndReplace(const Exp &pattern, SharedExp replacement, bool cc = false);
 
 public:
     /// Print the collected locations to stream \p os
     void print(OStream &os) const;
 
 private:
-    AssignSet m_defs; ///< The set of definitions.
+    /// Recompute \ref m_numAtDefs after the LHS of definitions might have changed.
+    void countAtDefs();
+
+private:
+    AssignSet m_defs;            ///< The set of definitions.
+    std::size_t m_numAtDefs = 0; ///< Number of definitions of the form foo@[x:y]
 };
@@ -0,0 +1,119 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "GlobalUseIndex.h"
+
+#include "boomerang/ssl/statements/Statement.h"
+#include "boomerang/util/StatementList.h"
+#include "boomerang/visitor/expvisitor/UsedGlobalFinder.h"
+#include "boomerang/visitor/stmtexpvisitor/StmtExpVisitor.h"
+
+
+static const ProcSet EMPTY_PROCSET;
+static const std::set<QString> EMPTY_NAMESET;
+
+
+/// Collect the names of all globals used by a single statement into \p used.
+static void collectUsedGlobals(const SharedStmt &stmt, std::set<QString> &used)
+{
+    if (stmt->isImplicit()) {
+        return; // Ignore the uses in ImplicitAssigns
+    }
+
+    UsedGlobalFinder finder(used);
+    StmtExpVisitor visitor(&finder);
+    stmt->accept(&visitor);
+}
+
+
+void GlobalUseIndex::updateUses(UserProc *proc)
+{
+    removeUses(proc);
+
+    std::set<QString> used;
+
+    for (const SharedStmt &stmt : proc->getStatements()) {
+        collectUsedGlobals(stmt, used);
+    }
+
+    if (used.empty()) {
+        return;
+    }
+
+    for (const QString &name : used) {
+        m_users[name].insert(proc);
+    }
+
+    m_usedGlobals[proc] = std::move(used);
+}
+
+
+void GlobalUseIndex::removeUses(UserProc *proc)
+{
+    auto it = m_usedGlobals.find(proc);
+    if (it == m_usedGlobals.end()) {
+        return;
+    }
+
+    for (const QString &name : it->second) {
+        auto userIt = m_users.find(name);
+        if (userIt == m_users.end()) {
+            continue;
+        }
+
+        userIt->second.erase(proc);
+        if (userIt->second.empty()) {
+            m_users.erase(userIt);
+        }
+    }
+
+    m_usedGlobals.erase(it);
+}
+
+
+void GlobalUseIndex::clear()
+{
+    m_users.clear();
+    m_usedGlobals.clear();
+}
+
+
+bool GlobalUseIndex::isUsed(const QString &globalName) const
+{
+    return m_users.find(globalName) != m_users.end();
+}
+
+
+const ProcSet &GlobalUseIndex::getUsers(const QString &globalName) const
+{
+    auto it = m_users.find(globalName);
+    return it != m_users.end() ? it->second : EMPTY_PROCSET;
+}
+
+
+const std::set<QString> &GlobalUseIndex::getUsedGlobals(const UserProc *proc) const
+{
+    auto it = m_usedGlobals.find(proc);
+    return it != m_usedGlobals.end() ? it->second : EMPTY_NAMESET;
+}
+
+
+void GlobalUseIndex::findUsingStatements(const QString &globalName, StatementList &stmts) const
+{
+    for (UserProc *proc : getUsers(globalName)) {
+        for (const SharedStmt &stmt : proc->getStatements()) {
+            std::set<QString> used;
+            collectUsedGlobals(stmt, used);
+
+            if (used.find(globalName) != used.end()) {
+                stmts.append(stmt);
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/db/proc/UserProc.h"
+
+#include <QString>
+
+#include <map>
+#include <set>
+
+
+class StatementList;
+
+
+/**
+ * Maps global variables (by name) to the user procedures that reference them.
+ *
+ * The index is maintained per procedure: whenever the statements of a procedure
+ * have changed in a way that might add or remove references to globals,
+ * the contribution of the procedure is recomputed with \ref updateUses.
+ * This avoids re-scanning the whole program each time the users of a global
+ * are queried.
+ */
+class BOOMERANG_API GlobalUseIndex
+{
+public:
+    GlobalUseIndex()                            = default;
+    GlobalUseIndex(const GlobalUseIndex &other) = delete;
+    GlobalUseIndex(GlobalUseIndex &&other)      = default;
+
+    ~GlobalUseIndex() = default;
+
+    GlobalUseIndex &operator=(const GlobalUseIndex &other) = delete;
+    GlobalUseIndex &operator=(GlobalUseIndex &&other) = default;
+
+public:
+    /// Re-scan the statements of \p proc and update the globals it uses.
+    /// Uses in implicit assignments are not counted, since they do not really exist
+    /// in the program representation.
+    void updateUses(UserProc *proc);
+
+    /// Forget all uses of globals by \p proc, e.g. because it is being removed.
+    void removeUses(UserProc *proc);
+
+    /// Forget all uses of all globals.
+    void clear();
+
+    /// \returns true if the global with name \p globalName is used by any indexed procedure.
+    bool isUsed(const QString &globalName) const;
+
+    /// \returns the set of procedures that use the global with name \p globalName.
+    const ProcSet &getUsers(const QString &globalName) const;
+
+    /// \returns the names of all globals used by \p proc.
+    const std::set<QString> &getUsedGlobals(const UserProc *proc) const;
+
+    /// Append all statements that use the global with name \p globalName to \p stmts.
+    /// Only the procedures referencing the global are searched.
+    void findUsingStatements(const QString &globalName, StatementList &stmts) const;
+
+    /// \returns the number of distinct used globals.
+    std::size_t getNumUsedGlobals() const { return m_users.size(); }
+
+private:
+    std::map<QString, ProcSet> m_users;                         ///< global name -> users
+    std::map<const UserProc *, std::set<QString>> m_usedGlobals; ///< proc -> used global names
+};
@@ -245,7 +245,7 @@ std::shared_ptr<ImplicitAssign> IRFragment::addImplicitAssign(const SharedExp &l
     assert(m_listOfRTLs);
 
     if (m_listOfRTLs->empty() || m_listOfRTLs->front()->getAddress() != Address::ZERO) {
-        m_listOfRTLs->push_front(std::unique_ptr<RTL>(new RTL(Address::ZERO)));
+        m_listOfRTLs->insert(m_listOfRTLs->begin(), std::unique_ptr<RTL>(new RTL(Address::ZERO)));
     }
 
     // do not allow BB with 2 zero address RTLs
@@ -282,7 +282,7 @@ std::shared_ptr<PhiAssign> IRFragment::addPhi(const SharedExp &usedExp)
     assert(m_listOfRTLs);
 
     if (m_listOfRTLs->empty() || m_listOfRTLs->front()->getAddress() != Address::ZERO) {
-        m_listOfRTLs->push_front(std::unique_ptr<RTL>(new RTL(Address::ZERO)));
+        m_listOfRTLs->insert(m_listOfRTLs->begin(), std::unique_ptr<RTL>(new RTL(Address::ZERO)));
     }
 
     // do not allow BB with 2 zero address RTLs
@@ -319,7 +319,7 @@ std::shared_ptr<PhiAssign> IRFragment::addPhi(const SharedExp &usedExp)
 void IRFragment::clearPhis()
 {
     RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     for (SharedStmt s = getFirstStmt(rit, sit); s; s = getNextStmt(rit, sit)) {
         if (!s->isPhi()) {
             continue;
@@ -14,15 +14,15 @@
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/util/StatementList.h"
 
-#include <list>
 #include <memory>
+#include <vector>
 
 
 class BasicBlock;
 class ImplicitAssign;
 class PhiAssign;
 
-using RTLList   = std::list<std::unique_ptr<RTL>>;
+using RTLList   = std::vector<std::unique_ptr<RTL>>;
 using SharedExp = std::shared_ptr<Exp>;
 
 
@@ -103,6 +103,8 @@ public:
      * Get first/next statement this BB
      * Somewhat intricate because of the post call semantics; these funcs save a lot of duplicated,
      * easily-bugged code
+     * \note RTLs and statements are stored in vectors, so \p rit and \p sit are invalidated
+     * when RTLs or statements are added to or removed from this fragment.
      */
     SharedStmt getFirstStmt(RTLIterator &rit, RTL::iterator &sit);
     SharedStmt getNextStmt(RTLIterator &rit, RTL::iterator &sit);
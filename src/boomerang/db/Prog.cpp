@@ -13,6 +13,7 @@
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/DebugInfo.h"
 #include "boomerang/db/Global.h"
+#include "boomerang/db/GlobalUseIndex.h"
 #include "boomerang/db/LowLevelCFG.h"
 #include "boomerang/db/binary/BinaryFile.h"
 #include "boomerang/db/binary/BinaryImage.h"
@@ -56,6 +57,7 @@ Prog::Prog(const QString &name, Project *project)
     , m_binaryFile(project ? project->getLoadedBinaryFile() : nullptr)
     , m_fe(nullptr)
     , m_cfg(new LowLevelCFG)
+    , m_globalUses(new GlobalUseIndex)
 {
     m_rootModule = getOrInsertModule(getName());
     assert(m_rootModule != nullptr);
@@ -71,6 +73,7 @@ void Prog::setFrontEnd(IFrontEnd *frontEnd)
 {
     m_fe = frontEnd;
 
+    m_globalUses->clear();
     m_moduleList.clear();
     m_rootModule = getOrInsertModule(m_name);
 }
@@ -264,6 +267,10 @@ bool Prog::removeFunction(const QString &name)
     Function *function = getFunctionByName(name);
 
     if (function) {
+        if (!function->isLib()) {
+            m_globalUses->removeUses(static_cast<UserProc *>(function));
+        }
+
         function->removeFromModule();
         m_project->alertFunctionRemoved(function);
         // FIXME: this function removes the function from module, but it leaks it
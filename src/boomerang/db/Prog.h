@@ -32,6 +32,7 @@ class BinaryFile;
 class BinarySection;
 class BinarySymbol;
 class Function;
+class GlobalUseIndex;
 class IFrontEnd;
 class LibProc;
 class Module;
@@ -248,6 +249,10 @@ public:
     /// Set the type of a global variable
     void setGlobalType(const QString &name, SharedType ty);
 
+    /// \returns the index mapping globals to the procedures that use them.
+    GlobalUseIndex &getGlobalUses() { return *m_globalUses; }
+    const GlobalUseIndex &getGlobalUses() const { return *m_globalUses; }
+
 private:
     QString m_name; ///< name of the program
     Project *m_project       = nullptr;
@@ -264,4 +269,5 @@ private:
     // FIXME: is a set of Globals the most appropriate data structure? Surely not.
     GlobalSet m_globals;         ///< globals to print at code generation time
     DataIntervalMap m_globalMap; ///< Map from address to DataInterval (has size, name, type)
+    std::unique_ptr<GlobalUseIndex> m_globalUses; ///< Map from global name to using procs
 };
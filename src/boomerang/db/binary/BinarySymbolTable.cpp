@@ -29,64 +29,77 @@ BinarySymbolTable::~BinarySymbolTable()
 void BinarySymbolTable::clear()
 {
     m_addrIndex.clear();
-    m_symbolList.clear();
     m_nameIndex.clear();
+    m_symbolList.clear();
+    m_ownedSymbols.clear();
+    m_stringPool.clear();
+}
+
+
+void BinarySymbolTable::reserve(std::size_t numSymbols)
+{
+    m_symbolList.reserve(numSymbols);
+    m_ownedSymbols.reserve(numSymbols);
+    m_addrIndex.reserve(numSymbols);
+    m_nameIndex.reserve(static_cast<int>(numSymbols));
+    m_stringPool.reserve(static_cast<int>(numSymbols));
 }
 
 
 BinarySymbol *BinarySymbolTable::createSymbol(Address addr, const QString &name, bool local)
 {
-    if (m_addrIndex.find(addr) != m_addrIndex.end()) {
+    if (m_addrIndex.find(addr.value()) != m_addrIndex.end()) {
         return nullptr; // symbol already exists
     }
 
     // If the symbol already exists, redirect the new symbol to the old one.
-    std::map<QString, std::shared_ptr<BinarySymbol>>::iterator it = m_nameIndex.find(name);
+    QHash<QString, BinarySymbol *>::const_iterator it = m_nameIndex.constFind(name);
 
-    if (it != m_nameIndex.end()) {
+    if (it != m_nameIndex.constEnd()) {
         LOG_WARN("Symbol '%1' already exists in the global symbol table!", name);
-        std::shared_ptr<BinarySymbol> existingSymbol = it->second;
-        m_addrIndex[addr]                            = existingSymbol;
-        return existingSymbol.get();
+        BinarySymbol *existingSymbol = it.value();
+        m_addrIndex[addr.value()]    = existingSymbol;
+        return existingSymbol;
     }
 
-    std::shared_ptr<BinarySymbol> sym = std::make_shared<BinarySymbol>(addr, name);
-    m_addrIndex[addr]                 = sym;
+    const QString internedName = intern(name);
+    m_ownedSymbols.emplace_back(new BinarySymbol(addr, internedName));
+    BinarySymbol *sym = m_ownedSymbols.back().get();
+
+    m_addrIndex[addr.value()] = sym;
 
     if (!local) {
-        m_nameIndex[name] = sym;
+        m_nameIndex.insert(internedName, sym);
     }
 
-    m_symbolList.push_back(sym.get());
-    return sym.get();
+    m_symbolList.push_back(sym);
+    return sym;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr)
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByAddress(Address addr) const
 {
-    auto ff = m_addrIndex.find(addr);
-    return (ff != m_addrIndex.end()) ? ff->second.get() : nullptr;
+    auto ff = m_addrIndex.find(addr.value());
+    return (ff != m_addrIndex.end()) ? ff->second : nullptr;
 }
 
 
 BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name)
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
 }
 
 
 const BinarySymbol *BinarySymbolTable::findSymbolByName(const QString &name) const
 {
-    auto ff = m_nameIndex.find(name);
-    return (ff != m_nameIndex.end()) ? ff->second.get() : nullptr;
+    return m_nameIndex.value(name, nullptr);
 }
 
 
@@ -97,23 +110,33 @@ bool BinarySymbolTable::renameSymbol(const QString &oldName, const QString &newN
     }
 
     auto oldIt = m_nameIndex.find(oldName);
-    auto newIt = m_nameIndex.find(newName);
 
     if (oldIt == m_nameIndex.end()) { // symbol not found
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%1' was not found.",
                   oldName, newName);
         return false;
     }
-    else if (newIt != m_nameIndex.end()) { // symbol name clash
+    else if (m_nameIndex.contains(newName)) { // symbol name clash
         LOG_ERROR("Could not rename symbol '%1' to '%2': A symbol with name '%2' already exists",
                   oldName, newName);
         return false;
     }
 
-    std::shared_ptr<BinarySymbol> oldSymbol = oldIt->second;
+    BinarySymbol *oldSymbol = oldIt.value();
     m_nameIndex.erase(oldIt);
-    oldSymbol->m_name    = newName;
-    m_nameIndex[newName] = oldSymbol;
+    oldSymbol->m_name = intern(newName);
+    m_nameIndex.insert(oldSymbol->m_name, oldSymbol);
 
     return true;
 }
+
+
+QString BinarySymbolTable::intern(const QString &name)
+{
+    QSet<QString>::const_iterator it = m_stringPool.constFind(name);
+    if (it != m_stringPool.constEnd()) {
+        return *it;
+    }
+
+    return *m_stringPool.insert(name);
+}
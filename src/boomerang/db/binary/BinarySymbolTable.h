@@ -12,8 +12,12 @@
 
 #include "boomerang/util/Address.h"
 
-#include <map>
+#include <QHash>
+#include <QSet>
+#include <QString>
+
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 
@@ -21,13 +25,11 @@ class BinarySymbol;
 
 
 /**
- * A simple class to implement a symbol table than can be looked up by address or by name.
+ * A symbol table than can be looked up by address or by name.
  *
- * \note Can't readily use operator[] overloaded for address and string parameters.
- * The main problem is that when you do symtab[0x100] = "main", the string map
- * doesn't see the string. If you have one of the maps be a pointer to the other string
- * and use a special comparison operator, then if the strings are ever changed,
- * then the map's internal rb-tree becomes invalid.
+ * The table is optimized for bulk loading followed by many lookups:
+ * Symbols are appended to flat arrays; lookups use hash indices.
+ * Symbol names are interned, so symbols and indices share their string data.
  */
 class BOOMERANG_API BinarySymbolTable
 {
@@ -64,6 +66,9 @@ public:
     bool empty() const { return m_symbolList.empty(); }
     void clear();
 
+    /// Reserve space for \p numSymbols symbols before bulk loading.
+    void reserve(std::size_t numSymbols);
+
     /// Creates a symbol if it does not exist.
     BinarySymbol *createSymbol(Address addr, const QString &name, bool local = false);
 
@@ -77,11 +82,20 @@ public:
     bool renameSymbol(const QString &oldName, const QString &newName);
 
 private:
-    /// The map indexed by address.
-    std::map<Address, std::shared_ptr<BinarySymbol>> m_addrIndex;
-
-    /// The map indexed by string. Note that the strings are stored twice.
-    std::map<QString, std::shared_ptr<BinarySymbol>> m_nameIndex;
+    /// \returns the shared copy of \p name from the string pool.
+    QString intern(const QString &name);
 
+private:
+    /// All symbols in order of creation.
     SymbolList m_symbolList;
+    std::vector<std::unique_ptr<BinarySymbol>> m_ownedSymbols;
+
+    /// Exact lookup by address. Several addresses may refer to the same symbol.
+    std::unordered_map<Address::value_type, BinarySymbol *> m_addrIndex;
+
+    /// Lookup of non-local symbols by name.
+    QHash<QString, BinarySymbol *> m_nameIndex;
+
+    /// Pool of symbol names; equal names share the same string data.
+    QSet<QString> m_stringPool;
 };
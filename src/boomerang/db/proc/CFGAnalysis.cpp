@@ -0,0 +1,385 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "CFGAnalysis.h"
+
+#include "boomerang/db/IRFragment.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/util/log/Log.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+CFGAnalysis::CFGAnalysis(const ProcCFG *cfg)
+{
+    assert(cfg != nullptr);
+
+    numberFragments(cfg);
+    snapshotEdges(cfg);
+
+    if (!m_entryFrag || m_frags.empty()) {
+        return; // nothing to do
+    }
+
+    const FragIndex entryIdx = fragToIdx(m_entryFrag);
+    if (entryIdx == INDEX_INVALID) {
+        LOG_ERROR("Entry fragment is not part of the CFG: %1", m_entryFrag->toString());
+        return;
+    }
+
+    m_valid = dfs(entryIdx) && calculateDominators(entryIdx);
+
+    if (m_valid) {
+        computeDF(entryIdx);
+    }
+
+    // Free memory only needed during the Lengauer-Tarjan algorithm
+    m_ancestor.clear();
+    m_ancestor.shrink_to_fit();
+    m_best.clear();
+    m_best.shrink_to_fit();
+}
+
+
+bool CFGAnalysis::isUpToDate(const ProcCFG *cfg) const
+{
+    if (cfg->getEntryFragment() != m_entryFrag ||
+        static_cast<std::size_t>(cfg->getNumFragments()) != m_frags.size()) {
+        return false;
+    }
+
+    FragIndex idx = 0;
+    for (const IRFragment *frag : *cfg) {
+        if (frag != m_frags[idx]) {
+            return false;
+        }
+
+        const auto &succs = frag->getSuccessors();
+        const auto &preds = frag->getPredecessors();
+
+        if (succs.size() != m_succBegin[idx + 1] - m_succBegin[idx] ||
+            preds.size() != m_predBegin[idx + 1] - m_predBegin[idx] ||
+            !std::equal(succs.begin(), succs.end(), m_succs.begin() + m_succBegin[idx]) ||
+            !std::equal(preds.begin(), preds.end(), m_preds.begin() + m_predBegin[idx])) {
+            return false;
+        }
+
+        ++idx;
+    }
+
+    return true;
+}
+
+
+FragIndex CFGAnalysis::fragToIdx(const IRFragment *frag) const
+{
+    auto it = m_indices.find(frag);
+    return it != m_indices.end() ? it->second : INDEX_INVALID;
+}
+
+
+FragIndex CFGAnalysis::getRevPostOrderNum(FragIndex idx) const
+{
+    const FragIndex postOrderNum = m_postOrderNum[idx];
+    return postOrderNum != INDEX_INVALID ? m_postOrder.size() - 1 - postOrderNum : INDEX_INVALID;
+}
+
+
+bool CFGAnalysis::strictlyDominates(FragIndex n, FragIndex w) const
+{
+    assert(n != INDEX_INVALID);
+    assert(w != INDEX_INVALID);
+
+    if (n == w || m_domPreNum[n] == INDEX_INVALID || m_domPreNum[w] == INDEX_INVALID) {
+        return false;
+    }
+
+    // n is a proper ancestor of w in the dominator tree
+    return m_domPreNum[n] < m_domPreNum[w] && m_domPostNum[w] < m_domPostNum[n];
+}
+
+
+void CFGAnalysis::numberFragments(const ProcCFG *cfg)
+{
+    const std::size_t numFrags = cfg->getNumFragments();
+
+    // Number all fragments, not only those reachable from the entry fragment
+    m_frags.reserve(numFrags);
+    m_indices.reserve(numFrags);
+
+    for (IRFragment *frag : *cfg) {
+        m_indices[frag] = m_frags.size();
+        m_frags.push_back(frag);
+    }
+
+    m_entryFrag = cfg->getEntryFragment();
+
+    m_preOrderNum.assign(numFrags, INDEX_INVALID);
+    m_postOrderNum.assign(numFrags, INDEX_INVALID);
+    m_parent.assign(numFrags, INDEX_INVALID);
+    m_ancestor.assign(numFrags, INDEX_INVALID);
+    m_best.assign(numFrags, INDEX_INVALID);
+    m_semi.assign(numFrags, INDEX_INVALID);
+    m_idom.assign(numFrags, INDEX_INVALID);
+    m_domChildren.assign(numFrags, {});
+    m_domPreNum.assign(numFrags, INDEX_INVALID);
+    m_domPostNum.assign(numFrags, INDEX_INVALID);
+    m_DF.assign(numFrags, {});
+}
+
+
+void CFGAnalysis::snapshotEdges(const ProcCFG *cfg)
+{
+    m_succBegin.reserve(m_frags.size() + 1);
+    m_predBegin.reserve(m_frags.size() + 1);
+
+    for (const IRFragment *frag : *cfg) {
+        m_succBegin.push_back(m_succs.size());
+        m_predBegin.push_back(m_preds.size());
+
+        m_succs.insert(m_succs.end(), frag->getSuccessors().begin(), frag->getSuccessors().end());
+        m_preds.insert(m_preds.end(), frag->getPredecessors().begin(),
+                       frag->getPredecessors().end());
+    }
+
+    m_succBegin.push_back(m_succs.size());
+    m_predBegin.push_back(m_preds.size());
+}
+
+
+bool CFGAnalysis::dfs(FragIndex entryIdx)
+{
+    bool ok = true;
+
+    // Explicit stack of (fragment, next successor to visit) so that deep CFGs
+    // do not overflow the call stack. Visits successors in the same order as a recursive search.
+    std::vector<std::pair<FragIndex, std::size_t>> stack;
+    stack.reserve(m_frags.size());
+
+    m_preOrderNum[entryIdx] = 0;
+    m_vertex.push_back(entryIdx);
+    stack.emplace_back(entryIdx, m_succBegin[entryIdx]);
+
+    while (!stack.empty()) {
+        const FragIndex idx = stack.back().first;
+        const std::size_t pos = stack.back().second;
+
+        if (pos == m_succBegin[idx + 1]) {
+            // all successors done
+            m_postOrderNum[idx] = m_postOrder.size();
+            m_postOrder.push_back(idx);
+            stack.pop_back();
+            continue;
+        }
+
+        stack.back().second++;
+
+        const IRFragment *succ = m_succs[pos];
+        const FragIndex succIdx = fragToIdx(succ);
+
+        if (succIdx == INDEX_INVALID) {
+            LOG_ERROR("Fragment not in CFG: %1", succ ? succ->toString() : "<null>");
+            ok = false;
+            continue;
+        }
+        else if (m_preOrderNum[succIdx] != INDEX_INVALID) {
+            continue; // already visited
+        }
+
+        m_preOrderNum[succIdx] = m_vertex.size();
+        m_parent[succIdx]      = idx;
+        m_vertex.push_back(succIdx);
+        stack.emplace_back(succIdx, m_succBegin[succIdx]);
+    }
+
+    return ok;
+}
+
+
+bool CFGAnalysis::calculateDominators(FragIndex entryIdx)
+{
+    const std::size_t N = m_vertex.size();
+    assert(N >= 1);
+
+    std::vector<std::vector<FragIndex>> bucket(m_frags.size()); ///< Deferred calculation
+    std::vector<FragIndex> samedom(m_frags.size(), INDEX_INVALID);
+
+    // Process fragments in reverse pre-traversal order (i.e. return blocks first)
+    for (std::size_t i = N - 1; i >= 1; i--) {
+        const FragIndex n = m_vertex[i];
+        const FragIndex p = m_parent[n];
+        FragIndex s       = p;
+
+        // These lines calculate the semi-dominator of n, based on the Semidominator Theorem
+        for (std::size_t predPos = m_predBegin[n]; predPos < m_predBegin[n + 1]; ++predPos) {
+            const IRFragment *pred = m_preds[predPos];
+            const FragIndex v      = fragToIdx(pred);
+
+            if (v == INDEX_INVALID) {
+                LOG_ERROR("Fragment not in CFG: %1", pred ? pred->toString() : "<null>");
+                return false;
+            }
+            else if (m_preOrderNum[v] == INDEX_INVALID) {
+                continue; // unreachable predecessors do not dominate anything
+            }
+
+            FragIndex sdash = v;
+
+            if (isAncestorOf(v, n)) {
+                sdash = m_semi[getAncestorWithLowestSemi(v)];
+            }
+
+            if (isAncestorOf(s, sdash)) {
+                s = sdash;
+            }
+        }
+
+        m_semi[n] = s;
+
+        // Calculation of n's dominator is deferred until the path from s to n
+        // has been linked into the forest
+        bucket[s].push_back(n);
+        link(p, n);
+
+        // for each v in bucket[p]
+        for (FragIndex v : bucket[p]) {
+            // Now that the path from p to v has been linked into the spanning forest,
+            // these lines calculate the dominator of v, based on the first clause of the
+            // Dominator Theorem, or else defer the calculation until y's dominator is known.
+            const FragIndex y = getAncestorWithLowestSemi(v);
+
+            if (m_semi[y] == m_semi[v]) {
+                m_idom[v] = p; // Success!
+            }
+            else {
+                samedom[v] = y; // Defer
+            }
+        }
+
+        bucket[p].clear();
+    }
+
+    for (std::size_t i = 1; i < N; i++) {
+        // Now all the deferred dominator calculations, based on the second clause of the Dominator
+        // Theorem, are performed.
+        const FragIndex n = m_vertex[i];
+
+        if (samedom[n] != INDEX_INVALID) {
+            m_idom[n] = m_idom[samedom[n]]; // Deferred success!
+        }
+    }
+
+    // the entry fragment is always executed.
+    m_idom[entryIdx] = entryIdx;
+    m_semi[entryIdx] = entryIdx;
+    return true;
+}
+
+
+FragIndex CFGAnalysis::getAncestorWithLowestSemi(FragIndex v)
+{
+    assert(v != INDEX_INVALID);
+
+    const FragIndex a = m_ancestor[v];
+    if (a != INDEX_INVALID && m_ancestor[a] != INDEX_INVALID) {
+        const FragIndex b = getAncestorWithLowestSemi(a);
+        m_ancestor[v]     = m_ancestor[a];
+
+        if (isAncestorOf(m_semi[m_best[v]], m_semi[b])) {
+            m_best[v] = b;
+        }
+    }
+
+    return m_best[v];
+}
+
+
+void CFGAnalysis::link(FragIndex p, FragIndex n)
+{
+    assert(n != INDEX_INVALID);
+
+    m_ancestor[n] = p;
+    m_best[n]     = n;
+}
+
+
+void CFGAnalysis::computeDF(FragIndex entryIdx)
+{
+    // Build the dominator tree; children are in ascending index order.
+    for (FragIndex idx = 0; idx < m_frags.size(); ++idx) {
+        if (idx != entryIdx && m_idom[idx] != INDEX_INVALID) {
+            m_domChildren[m_idom[idx]].push_back(idx);
+        }
+    }
+
+    // Number the dominator tree so that dominance can be checked in constant time,
+    // and collect the nodes in post order (children before parents)
+    std::vector<FragIndex> domPostOrder;
+    std::vector<std::pair<FragIndex, std::size_t>> stack;
+    domPostOrder.reserve(m_vertex.size());
+    stack.reserve(m_vertex.size());
+
+    FragIndex preNum  = 0;
+    FragIndex postNum = 0;
+
+    m_domPreNum[entryIdx] = preNum++;
+    stack.emplace_back(entryIdx, 0);
+
+    while (!stack.empty()) {
+        const FragIndex n = stack.back().first;
+        const std::size_t childPos = stack.back().second;
+
+        if (childPos == m_domChildren[n].size()) {
+            m_domPostNum[n] = postNum++;
+            domPostOrder.push_back(n);
+            stack.pop_back();
+            continue;
+        }
+
+        stack.back().second++;
+
+        const FragIndex c = m_domChildren[n][childPos];
+        m_domPreNum[c]    = preNum++;
+        stack.emplace_back(c, 0);
+    }
+
+    // Compute DF[n] = DF_local[n] U DF_up[c] for all children c;
+    // all children have been processed before their parent.
+    for (FragIndex n : domPostOrder) {
+        std::set<FragIndex> &S = m_DF[n];
+
+        // This loop computes DF_local[n]
+        // for each node y in succ(n)
+        for (std::size_t succPos = m_succBegin[n]; succPos < m_succBegin[n + 1]; ++succPos) {
+            const FragIndex y = fragToIdx(m_succs[succPos]);
+
+            if (m_idom[y] != n) {
+                S.insert(y);
+            }
+        }
+
+        // for each child c of n in the dominator tree
+        for (FragIndex c : m_domChildren[n]) {
+            // This loop computes DF_up[c]
+            // for each element w of DF[c]
+            for (FragIndex w : m_DF[c]) {
+                if (n == w || !strictlyDominates(n, w)) {
+                    S.insert(w);
+                }
+            }
+        }
+    }
+}
+
+
+bool CFGAnalysis::isAncestorOf(FragIndex n, FragIndex parent) const
+{
+    return m_preOrderNum[parent] < m_preOrderNum[n];
+}
@@ -0,0 +1,148 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+
+class IRFragment;
+class ProcCFG;
+
+typedef std::size_t FragIndex;
+static constexpr const FragIndex INDEX_INVALID = FragIndex(-1);
+
+
+/**
+ * Graph analyses of a ProcCFG that are shared between the SSA passes and code generation:
+ *  - a dense numbering of all fragments (in CFG order),
+ *  - pre-order, post-order and reverse post-order numbers of a depth first search
+ *    from the entry fragment,
+ *  - (semi-)dominators, the dominator tree and dominance frontiers.
+ *
+ * A CFGAnalysis is an immutable snapshot of the graph at the time it was computed.
+ * Use \ref ProcCFG::getAnalysis to get an analysis of the current graph;
+ * it is only recomputed when fragments or edges have changed.
+ */
+class BOOMERANG_API CFGAnalysis
+{
+public:
+    explicit CFGAnalysis(const ProcCFG *cfg);
+    CFGAnalysis(const CFGAnalysis &other) = delete;
+    CFGAnalysis(CFGAnalysis &&other)      = default;
+
+    ~CFGAnalysis() = default;
+
+    CFGAnalysis &operator=(const CFGAnalysis &other) = delete;
+    CFGAnalysis &operator=(CFGAnalysis &&other) = default;
+
+public:
+    /// \returns false if the graph could not be analyzed,
+    /// e.g. because there is no entry fragment or an edge leaves the CFG.
+    bool isValid() const { return m_valid; }
+
+    /// \returns true if the fragments and edges of \p cfg are the same
+    /// as when this analysis was computed.
+    bool isUpToDate(const ProcCFG *cfg) const;
+
+public:
+    std::size_t getNumFragments() const { return m_frags.size(); }
+
+    IRFragment *idxToFrag(FragIndex idx) const { return m_frags.at(idx); }
+
+    /// \returns the index of \p frag, or INDEX_INVALID if \p frag is not part of the CFG.
+    FragIndex fragToIdx(const IRFragment *frag) const;
+
+public:
+    /// \returns true if \p idx is reachable from the entry fragment.
+    bool isReachable(FragIndex idx) const { return m_preOrderNum[idx] != INDEX_INVALID; }
+
+    /// Depth first search numbers; INDEX_INVALID for unreachable fragments.
+    FragIndex getPreOrderNum(FragIndex idx) const { return m_preOrderNum[idx]; }
+    FragIndex getPostOrderNum(FragIndex idx) const { return m_postOrderNum[idx]; }
+    FragIndex getRevPostOrderNum(FragIndex idx) const;
+
+    /// \returns the indices of all reachable fragments in depth first post order.
+    const std::vector<FragIndex> &getPostOrder() const { return m_postOrder; }
+
+public:
+    /// \returns the semi-dominator of \p idx. The entry fragment is its own semi-dominator.
+    FragIndex getSemi(FragIndex idx) const { return m_semi[idx]; }
+
+    /// \returns the immediate dominator of \p idx. The entry fragment is its own dominator.
+    FragIndex getIdom(FragIndex idx) const { return m_idom[idx]; }
+
+    /// \returns the children of \p idx in the dominator tree, in ascending index order.
+    const std::vector<FragIndex> &getDomChildren(FragIndex idx) const { return m_domChildren[idx]; }
+
+    /// \returns true if \p n dominates \p w and n != w.
+    bool strictlyDominates(FragIndex n, FragIndex w) const;
+
+    const std::set<FragIndex> &getDominanceFrontier(FragIndex idx) const { return m_DF[idx]; }
+
+private:
+    void numberFragments(const ProcCFG *cfg);
+    void snapshotEdges(const ProcCFG *cfg);
+
+    /// Depth first search from the entry fragment.
+    /// \returns false if an edge leads to a fragment outside the CFG.
+    bool dfs(FragIndex entryIdx);
+
+    /// Lengauer-Tarjan with path compression.
+    /// Essentially Algorithm 19.9 of Appel's "Modern compiler implementation in Java" 2nd ed 2002
+    bool calculateDominators(FragIndex entryIdx);
+
+    /// Basically algorithm 19.10b of Appel 2002 (uses path compression for O(log N) amortised time
+    /// per operation (overall O(N log N))
+    FragIndex getAncestorWithLowestSemi(FragIndex v);
+
+    void link(FragIndex p, FragIndex n);
+
+    /// Numbers the dominator tree and computes the dominance frontiers bottom up.
+    void computeDF(FragIndex entryIdx);
+
+    /// \returns true if \p n is a proper descendant of \p parent in the depth first spanning tree
+    /// (i.e. has a higher pre-order number).
+    bool isAncestorOf(FragIndex n, FragIndex parent) const;
+
+private:
+    bool m_valid = false;
+
+    std::vector<IRFragment *> m_frags;                           ///< Maps index -> IRFragment
+    std::unordered_map<const IRFragment *, FragIndex> m_indices; ///< Maps IRFragment -> index
+    const IRFragment *m_entryFrag = nullptr;
+
+    /// Successors and predecessors of all fragments at the time of the analysis,
+    /// flattened. The edges of fragment i are [m_succBegin[i], m_succBegin[i+1]).
+    std::vector<const IRFragment *> m_succs;
+    std::vector<const IRFragment *> m_preds;
+    std::vector<std::size_t> m_succBegin;
+    std::vector<std::size_t> m_predBegin;
+
+    std::vector<FragIndex> m_preOrderNum;
+    std::vector<FragIndex> m_postOrderNum;
+    std::vector<FragIndex> m_postOrder;
+
+    std::vector<FragIndex> m_vertex;   ///< Maps pre-order number -> index
+    std::vector<FragIndex> m_parent;   ///< Parent in the depth first spanning tree
+    std::vector<FragIndex> m_ancestor; ///< Ancestor in the spanning forest during Lengauer-Tarjan
+    std::vector<FragIndex> m_best;     ///< Improves getAncestorWithLowestSemi
+    std::vector<FragIndex> m_semi;     ///< Semi-dominator of n
+    std::vector<FragIndex> m_idom;     ///< Immediate dominator of n
+
+    std::vector<std::vector<FragIndex>> m_domChildren;
+    std::vector<FragIndex> m_domPreNum;  ///< Pre-order number in the dominator tree
+    std::vector<FragIndex> m_domPostNum; ///< Post-order number in the dominator tree
+    std::vector<std::set<FragIndex>> m_DF; ///< Dominance frontier for every node n
+};
@@ -10,6 +10,7 @@
 #include "ProcCFG.h"
 
 #include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/proc/CFGAnalysis.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/signature/Parameter.h"
 #include "boomerang/ssl/RTL.h"
@@ -45,6 +46,10 @@ void ProcCFG::clear()
 
     qDeleteAll(begin(), end()); // deletes all fragments
     m_fragmentSet.clear();
+
+    m_entryFrag = nullptr;
+    m_exitFrag  = nullptr;
+    m_analysis.reset();
 }
 
 
@@ -112,7 +117,7 @@ void ProcCFG::removeFragment(IRFragment *frag)
     assert(this->hasFragment(frag));
 
     RTLList::iterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
 
     for (SharedStmt s = frag->getFirstStmt(rit, sit); s; s = frag->getNextStmt(rit, sit)) {
         if (s->isCall()) {
@@ -319,6 +324,16 @@ void ProcCFG::removeImplicitAssign(SharedExp x)
 }
 
 
+std::shared_ptr<const CFGAnalysis> ProcCFG::getAnalysis() const
+{
+    if (!m_analysis || !m_analysis->isUpToDate(this)) {
+        m_analysis = std::make_shared<const CFGAnalysis>(this);
+    }
+
+    return m_analysis;
+}
+
+
 void ProcCFG::print(OStream &out) const
 {
     out << "Control Flow Graph:\n";
@@ -18,19 +18,20 @@
 #include "boomerang/util/MapIterators.h"
 #include "boomerang/util/Util.h"
 
-#include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 
+class CFGAnalysis;
 class Function;
 class UserProc;
 class BasicBlock;
 class RTL;
 class Parameter;
 
-using RTLList = std::list<std::unique_ptr<RTL>>;
+using RTLList = std::vector<std::unique_ptr<RTL>>;
 
 enum class BBType;
 
@@ -147,6 +148,10 @@ public:
     bool isImplicitsDone() const { return m_implicitsDone; }
     void setImplicitsDone() { m_implicitsDone = true; }
 
+    /// \returns the dominator and depth first search analysis of the current graph.
+    /// The analysis is cached and only recomputed if fragments or edges changed since the last call.
+    std::shared_ptr<const CFGAnalysis> getAnalysis() const;
+
 public:
     /// print this CFG, mainly for debugging
     void print(OStream &out) const;
@@ -172,5 +177,8 @@ private:
     /// (e.g. with ad-hoc global assignment)
     bool m_implicitsDone = false;
 
+    /// Cached result of \ref getAnalysis
+    mutable std::shared_ptr<const CFGAnalysis> m_analysis;
+
     static IRFragment::FragID m_nextID;
 };
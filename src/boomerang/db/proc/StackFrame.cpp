@@ -0,0 +1,76 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "StackFrame.h"
+
+#include <algorithm>
+
+
+void StackFrame::clear()
+{
+    m_vars.clear();
+    m_maxEnd.clear();
+}
+
+
+void StackFrame::addVariable(int offset, const QString &name, SharedType type)
+{
+    const int size = static_cast<int>(type->getSize() / 8);
+    if (size <= 0) {
+        return;
+    }
+
+    auto it = std::lower_bound(m_vars.begin(), m_vars.end(), offset,
+                               [](const StackVariable &var, int off) { return var.offset < off; });
+    const std::size_t idx = it - m_vars.begin();
+
+    if (it != m_vars.end() && it->offset == offset) {
+        if (it->size >= size) {
+            return; // existing variable already covers the new one
+        }
+
+        *it = StackVariable{ offset, size, name, type };
+    }
+    else {
+        m_vars.insert(it, StackVariable{ offset, size, name, type });
+        m_maxEnd.insert(m_maxEnd.begin() + idx, 0);
+    }
+
+    // Update the maximum end offsets; they can only grow
+    int maxEnd = (idx > 0) ? m_maxEnd[idx - 1] : offset + size;
+
+    for (std::size_t i = idx; i < m_vars.size(); ++i) {
+        maxEnd = std::max(maxEnd, m_vars[i].offset + m_vars[i].size);
+
+        if (i > idx && m_maxEnd[i] == maxEnd) {
+            break; // all following entries are unchanged
+        }
+
+        m_maxEnd[i] = maxEnd;
+    }
+}
+
+
+const StackVariable *StackFrame::findVariable(int offset, bool interiorOnly) const
+{
+    // All variables before the first one that ends after offset end at or before offset.
+    const auto it = std::upper_bound(m_maxEnd.begin(), m_maxEnd.end(), offset);
+    if (it == m_maxEnd.end()) {
+        return nullptr;
+    }
+
+    // This variable ends after offset, so it covers offset if it starts at or before it.
+    // All following variables start after it.
+    const StackVariable &var = m_vars[it - m_maxEnd.begin()];
+    if (var.offset > offset || (interiorOnly && var.offset == offset)) {
+        return nullptr;
+    }
+
+    return &var;
+}
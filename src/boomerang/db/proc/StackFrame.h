@@ -0,0 +1,79 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/type/Type.h"
+
+#include <QString>
+
+#include <vector>
+
+
+/// A local variable in the stack frame of a procedure.
+struct StackVariable
+{
+    int offset;      ///< Stack offset of the variable in bytes
+    int size;        ///< Size of the variable in bytes
+    QString name;    ///< The name of the variable
+    SharedType type; ///< The type of the variable
+
+    /// \returns true if the variable covers the byte at stack offset \p off
+    bool contains(int off) const { return offset <= off && off < offset + size; }
+};
+
+
+/**
+ * Layout of the stack frame of a procedure.
+ * Maps stack offsets to the variables that occupy them, so that finding the variable
+ * covering a stack offset does not require scanning all symbols of the procedure.
+ *
+ * Stack offsets are measured downwards from the initial stack pointer,
+ * i.e. the local m[sp{0} - K] has offset K. A variable of size S at offset K
+ * covers the offsets K to K+S-1.
+ *
+ * Variables may overlap. There is at most one variable per start offset;
+ * if several variables start at the same offset, the largest one is kept.
+ *
+ * The sizes of the variables are taken from their types when they are added,
+ * so the frame must be rebuilt when the type of a variable changes.
+ */
+class BOOMERANG_API StackFrame
+{
+public:
+    /// \returns true if there are no variables in this frame.
+    bool isEmpty() const { return m_vars.empty(); }
+
+    /// \returns the number of variables in this frame.
+    std::size_t getNumVariables() const { return m_vars.size(); }
+
+    /// Remove all variables from this frame.
+    void clear();
+
+    /// Add the variable \p name of type \p type starting at stack offset \p offset.
+    /// Variables with a size of 0 bytes are ignored.
+    void addVariable(int offset, const QString &name, SharedType type);
+
+    /**
+     * \returns the variable with the lowest start offset that covers the byte
+     * at stack offset \p offset, or nullptr if there is no such variable.
+     * \param interiorOnly if true, ignore variables that start at \p offset.
+     */
+    const StackVariable *findVariable(int offset, bool interiorOnly = false) const;
+
+private:
+    std::vector<StackVariable> m_vars; ///< Variables sorted by start offset
+
+    /// m_maxEnd[i] is the highest end offset (exclusive) of the variables m_vars[0..i].
+    /// Since this is sorted, the first variable that might cover an offset
+    /// can be found by a binary search.
+    std::vector<int> m_maxEnd;
+};
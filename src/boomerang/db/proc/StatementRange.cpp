@@ -0,0 +1,126 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "StatementRange.h"
+
+
+StatementIterator::StatementIterator(ProcCFG::const_iterator fragIt,
+                                     ProcCFG::const_iterator fragEnd)
+    : m_fragIt(fragIt)
+    , m_fragEnd(fragEnd)
+{
+    if (m_fragIt != m_fragEnd) {
+        enterFragment();
+        skipEmpty();
+    }
+}
+
+
+bool StatementIterator::operator==(const StatementIterator &other) const
+{
+    if (m_fragIt != other.m_fragIt) {
+        return false;
+    }
+    else if (m_fragIt == m_fragEnd) {
+        return true; // both at end
+    }
+
+    return m_rtlIt == other.m_rtlIt && m_stmtIt == other.m_stmtIt;
+}
+
+
+StatementIterator &StatementIterator::operator++()
+{
+    assert(m_fragIt != m_fragEnd);
+
+    ++m_stmtIt;
+    skipEmpty();
+    return *this;
+}
+
+
+StatementIterator StatementIterator::operator++(int)
+{
+    StatementIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+
+void StatementIterator::enterFragment()
+{
+    m_rtls = (*m_fragIt)->getRTLs();
+
+    if (m_rtls) {
+        m_rtlIt = m_rtls->begin();
+
+        if (m_rtlIt != m_rtls->end()) {
+            m_stmtIt = (*m_rtlIt)->begin();
+        }
+    }
+}
+
+
+void StatementIterator::skipEmpty()
+{
+    while (m_fragIt != m_fragEnd) {
+        if (m_rtls) {
+            while (m_rtlIt != m_rtls->end()) {
+                if (m_stmtIt != (*m_rtlIt)->end()) {
+                    return; // found a statement
+                }
+
+                if (++m_rtlIt != m_rtls->end()) {
+                    m_stmtIt = (*m_rtlIt)->begin();
+                }
+            }
+        }
+
+        if (++m_fragIt != m_fragEnd) {
+            enterFragment();
+        }
+    }
+}
+
+
+StatementRange::StatementRange(const ProcCFG *cfg)
+    : m_cfg(cfg)
+{
+}
+
+
+StatementIterator StatementRange::begin() const
+{
+    return StatementIterator(m_cfg->begin(), m_cfg->end());
+}
+
+
+StatementIterator StatementRange::end() const
+{
+    return StatementIterator(m_cfg->end(), m_cfg->end());
+}
+
+
+std::vector<SharedStmt> StatementRange::snapshot() const
+{
+    std::size_t numStmts = 0;
+
+    for (const IRFragment *frag : *m_cfg) {
+        if (frag->getRTLs()) {
+            for (const auto &rtl : *frag->getRTLs()) {
+                numStmts += rtl->size();
+            }
+        }
+    }
+
+    std::vector<SharedStmt> result;
+    result.reserve(numStmts);
+    result.insert(result.end(), begin(), end());
+    return result;
+}
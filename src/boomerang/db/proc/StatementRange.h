@@ -0,0 +1,95 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/db/proc/ProcCFG.h"
+
+#include <iterator>
+#include <vector>
+
+
+/**
+ * Forward iterator over all statements of a ProcCFG,
+ * in fragment order, then RTL order, then statement order.
+ * Statements are visited in place; nothing is copied.
+ *
+ * \note Like the iterators of the underlying vectors, this iterator is invalidated
+ * when statements or RTLs are inserted into or removed from the current fragment,
+ * or when the fragment itself is removed.
+ * Passes that add or remove statements while iterating must use a snapshot instead
+ * (\ref StatementRange::snapshot).
+ */
+class BOOMERANG_API StatementIterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef SharedStmt value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const SharedStmt *pointer;
+    typedef const SharedStmt &reference;
+
+public:
+    StatementIterator(ProcCFG::const_iterator fragIt, ProcCFG::const_iterator fragEnd);
+
+public:
+    bool operator==(const StatementIterator &other) const;
+    bool operator!=(const StatementIterator &other) const { return !(*this == other); }
+
+    reference operator*() const { return *m_stmtIt; }
+    pointer operator->() const { return &*m_stmtIt; }
+
+    StatementIterator &operator++();
+    StatementIterator operator++(int);
+
+private:
+    /// Advance to the first statement of the next RTL or fragment
+    /// if the current position is not a valid statement.
+    void skipEmpty();
+
+    /// Set up the RTL and statement iterators for the current fragment.
+    void enterFragment();
+
+private:
+    ProcCFG::const_iterator m_fragIt;
+    ProcCFG::const_iterator m_fragEnd;
+    RTLList *m_rtls = nullptr; ///< RTLs of the current fragment
+    RTLList::iterator m_rtlIt;
+    RTL::iterator m_stmtIt;
+};
+
+
+/**
+ * A lightweight, non-allocating view of all statements of a procedure.
+ * Use this instead of copying the statements into a StatementList
+ * if the statements are only iterated over.
+ */
+class BOOMERANG_API StatementRange
+{
+public:
+    typedef StatementIterator iterator;
+    typedef StatementIterator const_iterator;
+
+public:
+    explicit StatementRange(const ProcCFG *cfg);
+
+public:
+    iterator begin() const;
+    iterator end() const;
+
+    bool empty() const { return begin() == end(); }
+
+    /// \returns a copy of all statements in the range.
+    /// Use this if statements are added or removed during iteration.
+    std::vector<SharedStmt> snapshot() const;
+
+private:
+    const ProcCFG *m_cfg;
+};
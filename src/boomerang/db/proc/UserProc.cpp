@@ -11,6 +11,7 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/GlobalUseIndex.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
 #include "boomerang/db/signature/Signature.h"
@@ -28,6 +29,7 @@
 #include "boomerang/ssl/statements/ReturnStatement.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/util/DFGWriter.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/UseGraphWriter.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/util/log/SeparateLogger.h"
@@ -45,6 +47,25 @@ bool lessUserProc::operator()(const UserProc *lhs, const UserProc *rhs) const
 }
 
 
+/// \returns true if \p e is of the form m[sp{...} - K] where sp is register \p sp,
+/// and sets \p offset to K.
+static bool isStackLocalPattern(const SharedConstExp &e, int sp, int &offset)
+{
+    if (!e->isMemOf() || e->getSubExp1()->getOper() != opMinus) {
+        return false;
+    }
+
+    SharedConstExp base = e->access<Exp, 1, 1>();
+    if (!base->isSubscript() || !base->getSubExp1()->isRegN(sp) ||
+        !e->access<Exp, 1, 2>()->isIntConst()) {
+        return false;
+    }
+
+    offset = e->access<Const, 1, 2>()->getInt();
+    return true;
+}
+
+
 UserProc::UserProc(Address address, const QString &name, Module *module)
     : Function(address, std::make_shared<Signature>(name), module)
     , m_cfg(new ProcCFG(this))
@@ -55,6 +76,10 @@ UserProc::UserProc(Address address, const QString &name, Module *module)
 
 UserProc::~UserProc()
 {
+    if (m_irArena) {
+        // The arena is freed when the last IR node of this proc is destroyed.
+        m_irArena->release();
+    }
 }
 
 
@@ -101,12 +126,27 @@ void UserProc::setStatus(ProcStatus s)
     if (m_status != s) {
         m_status = s;
         if (m_prog) {
+            if (s == ProcStatus::FinalDone) {
+                m_prog->getGlobalUses().updateUses(this);
+            }
+
             m_prog->getProject()->alertProcStatusChanged(this);
         }
     }
 }
 
 
+IRArena *UserProc::getIRArena()
+{
+    if (!m_irArena && m_prog && m_prog->getProject() &&
+        m_prog->getProject()->getSettings()->useIRArena) {
+        m_irArena = new IRArena;
+    }
+
+    return m_irArena;
+}
+
+
 void UserProc::setDecoded()
 {
     setStatus(ProcStatus::Decoded);
@@ -138,7 +178,7 @@ void UserProc::numberStatements() const
 
     for (IRFragment *frag : *m_cfg) {
         IRFragment::RTLIterator rit;
-        StatementList::iterator sit;
+        RTL::iterator sit;
         for (SharedStmt s = frag->getFirstStmt(rit, sit); s; s = frag->getNextStmt(rit, sit)) {
             s->setNumber(++stmtNumber);
         }
@@ -332,6 +372,8 @@ std::shared_ptr<Assign> UserProc::replacePhiByAssign(const std::shared_ptr<const
                         m_symbolMap.insert(elem);
                     }
 
+                    m_stackFrameValid = false;
+
                     return asgn;
                 }
             }
@@ -559,7 +601,9 @@ SharedExp UserProc::createLocal(SharedType ty, const SharedExp &e, const QString
     }
 
     LOG_VERBOSE2("Assigning type %1 to new %2", ty->getCtype(), localName);
-    m_locals[localName] = ty;
+    if (!m_locals.insert_or_assign(localName, ty).second || m_stackFrameHasUntyped) {
+        m_stackFrameValid = false; // size of a stack local changed or became known
+    }
 
     return Location::local(localName, this);
 }
@@ -567,11 +611,14 @@ SharedExp UserProc::createLocal(SharedType ty, const SharedExp &e, const QString
 
 void UserProc::addLocal(SharedType ty, const QString &name, SharedExp e)
 {
+    // assert(locals.find(name) == locals.end());        // Could be r10{20} -> o2, r10{30}->o2 now
+    if (!m_locals.insert_or_assign(name, ty).second || m_stackFrameHasUntyped) {
+        m_stackFrameValid = false; // size of a stack local changed or became known
+    }
+
     // symbolMap is a multimap now; you might have r8->o0 for integers and r8->o0_1 for char*
     // assert(symbolMap.find(e) == symbolMap.end());
     mapSymbolTo(e, Location::local(name, this));
-    // assert(locals.find(name) == locals.end());        // Could be r10{20} -> o2, r10{30}->o2 now
-    m_locals[name] = ty;
 }
 
 
@@ -617,39 +664,18 @@ SharedExp UserProc::getSymbolExp(SharedExp le, SharedType ty, bool lastPass)
     SharedExp e = nullptr;
 
     // check for references to the middle of a local
-    if (le->isMemOf() && le->getSubExp1()->getOper() == opMinus &&
-        le->getSubExp1()->getSubExp1()->isSubscript() &&
-        le->getSubExp1()->getSubExp1()->getSubExp1()->isRegN(m_signature->getStackRegister()) &&
-        le->getSubExp1()->getSubExp2()->isIntConst()) {
-        for (auto &elem : m_symbolMap) {
-            if (!(elem).second->isLocal()) {
-                continue;
-            }
-
-            QString name = elem.second->access<Const, 1>()->getStr();
-
-            if (m_locals.find(name) == m_locals.end()) {
-                continue;
-            }
-
-            SharedType lty     = m_locals[name];
-            SharedConstExp loc = elem.first;
-
-            if (loc->isMemOf() && loc->getSubExp1()->getOper() == opMinus &&
-                loc->access<Exp, 1, 1>()->isSubscript() &&
-                loc->access<Exp, 1, 1, 1>()->isRegN(m_signature->getStackRegister()) &&
-                loc->access<Exp, 1, 2>()->isIntConst()) {
-                const int byteOffset = le->access<Const, 1, 2>()->getInt() -
-                                       loc->access<Const, 1, 2>()->getInt();
-
-                if (Util::inRange(byteOffset, 1, static_cast<int>(lty->getSize() / 8))) {
-                    e = Location::memOf(Binary::get(opPlus,
-                                                    Unary::get(opAddrOf, elem.second->clone()),
-                                                    Const::get(byteOffset)));
-                    LOG_VERBOSE("Seems %1 is in the middle of %2 returning %3", le, loc, e);
-                    return e;
-                }
-            }
+    int stackOffset = 0;
+    if (isStackLocalPattern(le, m_signature->getStackRegister(), stackOffset)) {
+        const StackVariable *var = getStackFrame().findVariable(stackOffset, true);
+
+        if (var != nullptr) {
+            const int byteOffset = stackOffset - var->offset;
+
+            e = Location::memOf(Binary::get(opPlus,
+                                            Unary::get(opAddrOf, Location::local(var->name, this)),
+                                            Const::get(byteOffset)));
+            LOG_VERBOSE("Seems %1 is in the middle of %2 returning %3", le, var->name, e);
+            return e;
         }
     }
 
@@ -699,6 +725,32 @@ QString UserProc::findLocal(const SharedExp &e, SharedType ty)
 }
 
 
+void UserProc::removeLocals(const QSet<QString> &names)
+{
+    if (names.empty()) {
+        return;
+    }
+
+    for (const QString &name : names) {
+        m_locals.erase(name);
+    }
+
+    // Also remove them from the symbols, since symbols are a superset of locals at present
+    for (SymbolMap::iterator sm = m_symbolMap.begin(); sm != m_symbolMap.end();) {
+        const SharedExp &mapsTo = sm->second;
+
+        if (mapsTo->isLocal() && names.contains(mapsTo->access<Const, 1>()->getStr())) {
+            sm = m_symbolMap.erase(sm);
+        }
+        else {
+            ++sm;
+        }
+    }
+
+    m_stackFrameValid = false;
+}
+
+
 SharedConstType UserProc::getLocalType(const QString &name) const
 {
     auto it = m_locals.find(name);
@@ -710,7 +762,8 @@ void UserProc::setLocalType(const QString &name, SharedType ty)
 {
     const auto it = m_locals.find(name);
     if (it != m_locals.end()) {
-        it->second = ty;
+        it->second        = ty;
+        m_stackFrameValid = false;
         LOG_VERBOSE("Updating type of '%1' to %2", name, ty->getCtype());
     }
 }
@@ -753,6 +806,26 @@ SharedConstExp UserProc::expFromSymbol(const QString &name) const
 }
 
 
+void UserProc::clearSymbolMap()
+{
+    m_symbolMap.clear();
+    m_stackFrame.clear();
+    m_stackFrameValid      = true;
+    m_stackFrameHasUntyped = false;
+}
+
+
+void UserProc::removeSymbol(const SharedConstExp &from)
+{
+    SymbolMap::iterator it = m_symbolMap.find(from);
+
+    if (it != m_symbolMap.end()) {
+        m_symbolMap.erase(it);
+        m_stackFrameValid = false;
+    }
+}
+
+
 void UserProc::mapSymbolTo(const SharedConstExp &from, SharedExp to)
 {
     assert(from && to);
@@ -769,6 +842,45 @@ void UserProc::mapSymbolTo(const SharedConstExp &from, SharedExp to)
 
     std::pair<SharedConstExp, SharedExp> pr = { from, to };
     m_symbolMap.insert(pr);
+
+    if (m_stackFrameValid) {
+        addToStackFrame(from, to);
+    }
+}
+
+
+const StackFrame &UserProc::getStackFrame()
+{
+    if (!m_stackFrameValid) {
+        m_stackFrame.clear();
+        m_stackFrameValid      = true;
+        m_stackFrameHasUntyped = false;
+
+        for (const auto &[from, to] : m_symbolMap) {
+            addToStackFrame(from, to);
+        }
+    }
+
+    return m_stackFrame;
+}
+
+
+void UserProc::addToStackFrame(const SharedConstExp &from, const SharedConstExp &to)
+{
+    int offset = 0;
+    if (!to->isLocal() || !isStackLocalPattern(from, m_signature->getStackRegister(), offset)) {
+        return;
+    }
+
+    const QString name = to->access<Const, 1>()->getStr();
+    const auto it      = m_locals.find(name);
+
+    if (it != m_locals.end()) {
+        m_stackFrame.addVariable(offset, name, it->second);
+    }
+    else {
+        m_stackFrameHasUntyped = true; // added as soon as the type of the local is known
+    }
 }
 
 
@@ -843,7 +955,7 @@ void UserProc::markAsNonChildless(const std::shared_ptr<ProcSet> &cs)
     assert(cs);
 
     IRFragment::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
+    RTL::reverse_iterator srit;
 
     for (IRFragment *frag : *m_cfg) {
         SharedStmt s = frag->getLastStmt(rrit, srit);
@@ -14,10 +14,15 @@
 #include "boomerang/db/UseCollector.h"
 #include "boomerang/db/proc/Proc.h"
 #include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/StackFrame.h"
+#include "boomerang/db/proc/StatementRange.h"
 #include "boomerang/util/StatementList.h"
 
+#include <QSet>
+
 
 class Binary;
+class IRArena;
 class UserProc;
 class Assign;
 class ReturnStatement;
@@ -105,6 +110,11 @@ public:
     DataFlow *getDataFlow() { return &m_df; }
     const DataFlow *getDataFlow() const { return &m_df; }
 
+    /// \returns the memory pool for IR nodes of this procedure,
+    /// or nullptr if IR nodes are allocated from the global heap.
+    /// The pool is created on first use if enabled in the settings.
+    IRArena *getIRArena();
+
     const std::shared_ptr<ProcSet> &getRecursionGroup() { return m_recursionGroup; }
     void setRecursionGroup(const std::shared_ptr<ProcSet> &recursionGroup)
     {
@@ -151,6 +161,10 @@ public:
     /// \returns all statements in this UserProc
     void getStatements(StatementList &stmts) const;
 
+    /// \returns a view of all statements in this UserProc without copying them.
+    /// \sa StatementRange
+    StatementRange getStatements() const { return StatementRange(m_cfg.get()); }
+
     /// Remove (but not delete) \p stmt from this UserProc
     /// \returns true iff successfully removed
     bool removeStatement(const SharedStmt &stmt);
@@ -221,7 +235,9 @@ public:
     // local variable related
 
     const std::map<QString, SharedType> &getLocals() const { return m_locals; }
-    std::map<QString, SharedType> &getLocals() { return m_locals; }
+
+    /// Remove the local variables \p names and all symbols that map to them.
+    void removeLocals(const QSet<QString> &names);
 
     /**
      * Return the next available local variable; make it the given type.
@@ -258,9 +274,14 @@ public:
 
 public:
     // symbol related
-    SymbolMap &getSymbolMap() { return m_symbolMap; }
     const SymbolMap &getSymbolMap() const { return m_symbolMap; }
 
+    /// Remove all symbols.
+    void clearSymbolMap();
+
+    /// Remove one symbol for \p from, if any.
+    void removeSymbol(const SharedConstExp &from);
+
     /// \returns the original expression that maps to the local variable with name \p name
     /// Example: If eax maps to the local variable foo, return eax
     /// (not Location::local("foo", proc))
@@ -379,6 +400,12 @@ private:
     /// first compatible type is returned
     SharedExp getSymbolFor(const SharedConstExp &e, const SharedConstType &ty) const;
 
+    /// \returns the stack frame layout of the local variables, rebuilding it if necessary.
+    const StackFrame &getStackFrame();
+
+    /// Add the local \p to to the stack frame if \p from is a stack location.
+    void addToStackFrame(const SharedConstExp &from, const SharedConstExp &to);
+
     /// Set a location as a new premise, i.e. assume e=e
     void setPremise(const SharedExp &e);
 
@@ -396,6 +423,9 @@ private:
 
     std::unique_ptr<ProcCFG> m_cfg; ///< The control flow graph.
 
+    /// Memory pool for the IR nodes of this procedure (owned, see IRArena::release).
+    IRArena *m_irArena = nullptr;
+
     /// DataFlow object. Holds information relevant to transforming to and from SSA form.
     DataFlow m_df;
 
@@ -430,6 +460,14 @@ private:
      */
     std::map<QString, SharedType> m_locals;
 
+    /// Index of the stack locals in \ref m_symbolMap by stack offset.
+    /// Rebuilt on demand if the symbol map or the locals were changed in other ways
+    /// than by adding new symbols. Types of locals must be changed by \ref setLocalType,
+    /// not in place, for the stack frame to notice.
+    StackFrame m_stackFrame;
+    bool m_stackFrameValid      = true;
+    bool m_stackFrameHasUntyped = false; ///< Some stack symbols map to locals without a type
+
     /**
      * A collector for initial parameters (locations used before being defined).
      * Note that final parameters don't use this;
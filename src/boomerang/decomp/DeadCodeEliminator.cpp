@@ -0,0 +1,110 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DeadCodeEliminator.h"
+
+#include "boomerang/core/Project.h"
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/util/LocationSet.h"
+#include "boomerang/util/log/Log.h"
+
+
+DeadCodeEliminator::DeadCodeEliminator(UserProc *proc)
+    : m_proc(proc)
+{
+}
+
+
+std::size_t DeadCodeEliminator::mark(const StmtPredicate &isRemovable)
+{
+    m_dead.clear();
+
+    // Number of uses of each definition by statements that are not dead (yet).
+    // Removable statements are in the map even if they are not used.
+    std::unordered_map<const Statement *, int> refCounts;
+    std::vector<SharedStmt> workList;
+
+    for (const SharedStmt &s : m_proc->getStatements()) {
+        if (isRemovable(s)) {
+            refCounts.emplace(s.get(), 0);
+        }
+    }
+
+    for (const SharedStmt &s : m_proc->getStatements()) {
+        // Don't count uses in implicit statements. There is no RHS of course,
+        // but you can still have x from m[x] on the LHS and so on, but these are not real uses
+        if (s->isImplicit()) {
+            continue;
+        }
+
+        LocationSet refs;
+        s->addUsedLocs(refs, false); // Ignore uses in collectors
+
+        for (const SharedExp &rr : refs) {
+            if (rr->isSubscript() && rr->access<RefExp>()->getDef()) {
+                refCounts[rr->access<RefExp>()->getDef().get()]++;
+            }
+        }
+    }
+
+    for (const SharedStmt &s : m_proc->getStatements()) {
+        if (isRemovable(s) && refCounts[s.get()] == 0) {
+            workList.push_back(s);
+        }
+    }
+
+    while (!workList.empty()) {
+        const SharedStmt s = workList.back();
+        workList.pop_back();
+        m_dead.push_back(s);
+
+        // The definitions used by a dead statement lose one use, even if they are used
+        // several times by the statement.
+        LocationSet refs;
+        s->addUsedLocs(refs, false);
+
+        std::unordered_map<const Statement *, SharedStmt> usedDefs;
+        for (const SharedExp &rr : refs) {
+            if (rr->isSubscript() && rr->access<RefExp>()->getDef()) {
+                const SharedStmt &def = rr->access<RefExp>()->getDef();
+                usedDefs.emplace(def.get(), def);
+            }
+        }
+
+        for (const auto &[ptr, def] : usedDefs) {
+            auto it = refCounts.find(ptr);
+            if (it != refCounts.end() && --it->second == 0 && isRemovable(def)) {
+                workList.push_back(def);
+            }
+        }
+    }
+
+    return m_dead.size();
+}
+
+
+std::size_t DeadCodeEliminator::sweep()
+{
+    const bool debugUnused = m_proc->getProg()->getProject()->getSettings()->debugUnused;
+
+    for (const SharedStmt &s : m_dead) {
+        if (debugUnused) {
+            LOG_MSG("Removing unused statement %1 %2", s->getNumber(), s);
+        }
+
+        m_proc->removeStatement(s);
+    }
+
+    const std::size_t numRemoved = m_dead.size();
+    m_dead.clear();
+    return numRemoved;
+}
@@ -0,0 +1,64 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/statements/Statement.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+
+class UserProc;
+
+
+/**
+ * Dead code elimination for a procedure in SSA form by reference counting.
+ *
+ * A removable statement is dead if it is not used by any other statement, or only used
+ * by dead statements. Statements that are not removable (e.g. calls, branches, returns,
+ * stores to memory) are always live. The statements are visited with a work list,
+ * so each use is only counted and uncounted once.
+ *
+ * Statements that only use each other (e.g. dead loop counters) are not found,
+ * since their reference counts never drop to zero.
+ *
+ * Uses in implicit statements and in collectors are not counted, since they are not real uses.
+ */
+class BOOMERANG_API DeadCodeEliminator
+{
+public:
+    using StmtPredicate = std::function<bool(const SharedStmt &)>;
+
+public:
+    explicit DeadCodeEliminator(UserProc *proc);
+
+public:
+    /**
+     * Find the dead statements of the procedure.
+     * \param isRemovable returns true for statements that may be removed if they are dead.
+     *                    All other statements are live.
+     * \returns the number of dead statements.
+     */
+    std::size_t mark(const StmtPredicate &isRemovable);
+
+    /// Remove all dead statements found by the last call to \ref mark from the procedure.
+    /// \returns the number of removed statements.
+    std::size_t sweep();
+
+    /// \returns the dead statements found by the last call to \ref mark
+    const std::vector<SharedStmt> &getDeadStatements() const { return m_dead; }
+
+private:
+    UserProc *m_proc;
+    std::vector<SharedStmt> m_dead;
+};
@@ -0,0 +1,86 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ExpPatternTable.h"
+
+#include "boomerang/ssl/exp/Exp.h"
+
+
+ExpPatternTable::ExpPatternTable(const std::vector<SharedConstExp> &patterns)
+    : m_patterns(patterns)
+{
+    for (int i = 0; i < static_cast<int>(patterns.size()); ++i) {
+        const Exp *pattern = stripRefs(patterns[i].get());
+        OPER childOper     = opWild;
+
+        if (pattern->getArity() > 0) {
+            childOper = stripRefs(pattern->getSubExp1().get())->getOper();
+            childOper = isWildcard(childOper) ? opWild : childOper;
+        }
+
+        if (isWildcard(pattern->getOper())) {
+            // may match any expression
+            for (std::vector<Candidate> &candidates : m_candidates) {
+                candidates.push_back({ i, opWild });
+            }
+        }
+        else {
+            m_candidates[pattern->getOper()].push_back({ i, childOper });
+        }
+    }
+}
+
+
+int ExpPatternTable::match(const SharedConstExp &e) const
+{
+    const Exp *stripped = stripRefs(e.get());
+    const OPER rootOper = stripped->getOper();
+
+    if (isWildcard(rootOper)) {
+        // Wildcards match everything; there is nothing to index on.
+        for (int i = 0; i < static_cast<int>(m_patterns.size()); ++i) {
+            if (e->equalNoSubscript(*m_patterns[i])) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    const std::vector<Candidate> &candidates = m_candidates[rootOper];
+    if (candidates.empty()) {
+        return -1;
+    }
+
+    const OPER childOper = stripped->getArity() > 0
+                               ? stripRefs(stripped->getSubExp1().get())->getOper()
+                               : opWild;
+
+    for (const Candidate &candidate : candidates) {
+        if (candidate.childOper != opWild && candidate.childOper != childOper &&
+            !isWildcard(childOper)) {
+            continue;
+        }
+        else if (e->equalNoSubscript(*m_patterns[candidate.patternIdx])) {
+            return candidate.patternIdx;
+        }
+    }
+
+    return -1;
+}
+
+
+const Exp *ExpPatternTable::stripRefs(const Exp *e)
+{
+    while (e->isSubscript()) {
+        e = e->getSubExp1().get();
+    }
+
+    return e;
+}
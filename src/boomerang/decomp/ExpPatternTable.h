@@ -0,0 +1,53 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/exp/ExpHelp.h"
+#include "boomerang/ssl/exp/Operator.h"
+
+#include <array>
+#include <vector>
+
+
+/**
+ * An ordered list of expression patterns, compiled into a decision tree on the
+ * operators of the root and of the first subexpression of the patterns (ignoring subscripts).
+ * Matching an expression only compares it against the patterns that can possibly match,
+ * but returns the same result as trying all patterns in order with Exp::equalNoSubscript.
+ */
+class BOOMERANG_API ExpPatternTable
+{
+    /// Number of entries of tables indexed by OPER
+    static constexpr std::size_t NUM_OPERS = opFLF + 1;
+
+    struct Candidate
+    {
+        int patternIdx;
+        OPER childOper; ///< required operator of the first subexpression, or opWild for any
+    };
+
+public:
+    explicit ExpPatternTable(const std::vector<SharedConstExp> &patterns);
+
+public:
+    /// \returns the index of the first pattern that matches \p e, or -1 if none matches.
+    int match(const SharedConstExp &e) const;
+
+private:
+    static bool isWildcard(OPER oper) { return oper < 0; }
+
+    static const Exp *stripRefs(const Exp *e);
+
+private:
+    std::vector<SharedConstExp> m_patterns;
+    std::array<std::vector<Candidate>, NUM_OPERS> m_candidates;
+};
@@ -14,6 +14,7 @@
 #include "boomerang/db/LowLevelCFG.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/ExpPatternTable.h"
 #include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Binary.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -110,6 +111,24 @@ static const SwitchForm hlForms[] = {
 // clang-format on
 
 
+std::vector<SharedConstExp> IndirectJumpAnalyzer::getSwitchPatterns()
+{
+    std::vector<SharedConstExp> patterns;
+    for (const SwitchForm &form : hlForms) {
+        patterns.push_back(form.pattern);
+    }
+
+    return patterns;
+}
+
+
+static const ExpPatternTable &getSwitchFormTable()
+{
+    static const ExpPatternTable table(IndirectJumpAnalyzer::getSwitchPatterns());
+    return table;
+}
+
+
 /// Find all the possible constant values that the location defined by s could be assigned with
 static void findConstantValues(const SharedConstStmt &s, std::list<int> &dests)
 {
@@ -426,16 +445,13 @@ bool IndirectJumpAnalyzer::analyzeCompJump(IRFragment *frag, UserProc *proc)
     }
 
     SwitchType switchType = SwitchType::Invalid;
+    const int formIdx     = getSwitchFormTable().match(jumpDest);
 
-    for (auto &val : hlForms) {
-        if (jumpDest->equalNoSubscript(*val.pattern)) {
-            switchType = val.type;
+    if (formIdx != -1) {
+        switchType = hlForms[formIdx].type;
 
-            if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
-                LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
-            }
-
-            break;
+        if (proc->getProg()->getProject()->getSettings()->debugSwitch) {
+            LOG_MSG("Indirect jump matches form %1", static_cast<char>(switchType));
         }
     }
 
@@ -628,6 +644,25 @@ static const std::vector<std::pair<const SharedConstExp, IndCallPattern>> hlCall
 // clang-format on
 
 
+std::vector<SharedConstExp> IndirectJumpAnalyzer::getCallPatterns()
+{
+    std::vector<SharedConstExp> patterns;
+    for (const auto &[pattern, patternID] : hlCallPatterns) {
+        Q_UNUSED(patternID);
+        patterns.push_back(pattern);
+    }
+
+    return patterns;
+}
+
+
+static const ExpPatternTable &getCallPatternTable()
+{
+    static const ExpPatternTable table(IndirectJumpAnalyzer::getCallPatterns());
+    return table;
+}
+
+
 bool IndirectJumpAnalyzer::analyzeCompCall(IRFragment *frag, UserProc *proc)
 {
     Prog *prog = proc->getProg();
@@ -665,16 +700,15 @@ bool IndirectJumpAnalyzer::analyzeCompCall(IRFragment *frag, UserProc *proc)
         LOG_MSG("decodeIndirect: propagated and const global converted call expression is %1", e);
     }
 
+    const int patternIdx = getCallPatternTable().match(e);
+
     IndCallPattern foundPatternID = IndCallPattern::Invalid;
 
-    for (auto &[pattern, patternID] : hlCallPatterns) {
-        if (e->equalNoSubscript(*pattern)) {
-            foundPatternID = patternID;
-            if (prog->getProject()->getSettings()->debugSwitch) {
-                LOG_MSG("Indirect call matches pattern '%1'", pattern);
-            }
+    if (patternIdx != -1) {
+        foundPatternID = hlCallPatterns[patternIdx].second;
 
-            break;
+        if (prog->getProject()->getSettings()->debugSwitch) {
+            LOG_MSG("Indirect call matches pattern '%1'", hlCallPatterns[patternIdx].first);
         }
     }
 
@@ -11,8 +11,11 @@
 
 
 #include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/ssl/exp/ExpHelp.h"
 #include "boomerang/util/Address.h"
 
+#include <vector>
+
 
 class IRFragment;
 class UserProc;
@@ -50,6 +53,13 @@ public:
      */
     int findNumCases(const IRFragment *frag);
 
+public:
+    /// \returns the patterns of the high level switch forms, in the order they are matched.
+    static std::vector<SharedConstExp> getSwitchPatterns();
+
+    /// \returns the patterns of indirect calls, in the order they are matched.
+    static std::vector<SharedConstExp> getCallPatterns();
+
 private:
     /// Analyze a basic block ending with a computed jump.
     bool analyzeCompJump(IRFragment *frag, UserProc *proc);
@@ -77,7 +77,7 @@ bool LivenessAnalyzer::calcLiveness(IRFragment *frag, ConnectionGraph &ig, UserP
     if (frag->getRTLs()) {
         // For all statements in this fragment in reverse order
         IRFragment::RTLRIterator rit;
-        StatementList::reverse_iterator sit;
+        RTL::reverse_iterator sit;
 
         for (SharedStmt s = frag->getLastStmt(rit, sit); s; s = frag->getPrevStmt(rit, sit)) {
             LocationSet defs;
@@ -21,6 +21,8 @@
 #include "boomerang/ssl/exp/Ternary.h"
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/ReturnStatement.h"
+#include "boomerang/util/IRArena.h"
+#include "boomerang/util/Tracer.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/util/log/SeparateLogger.h"
 
@@ -32,6 +34,7 @@ ProcDecompiler::ProcDecompiler()
 
 void ProcDecompiler::decompileRecursive(UserProc *proc)
 {
+    m_scopeDepths[proc] = 0;
     tryDecompileRecursive(proc);
 }
 
@@ -39,6 +42,8 @@ void ProcDecompiler::decompileRecursive(UserProc *proc)
 ProcStatus ProcDecompiler::tryDecompileRecursive(UserProc *proc)
 {
     Project *project = proc->getProg()->getProject();
+    IRArena::Scope arenaScope(proc->getIRArena());
+    TraceScope trace("proc", proc->getName());
 
     if (proc->getStatus() < ProcStatus::Visited) {
         LOG_MSG("Visiting procedure '%1'", proc->getName());
@@ -248,6 +253,7 @@ void ProcDecompiler::addToRecursionGroup(UserProc *proc,
 
 void ProcDecompiler::earlyDecompile(UserProc *proc)
 {
+    TraceScope trace("proc", "earlyDecompile", proc->getName());
     Project *project = proc->getProg()->getProject();
     project->alertStartDecompile(proc);
     project->alertDecompileDebugPoint(proc, "before earlyDecompile");
@@ -280,6 +286,7 @@ void ProcDecompiler::earlyDecompile(UserProc *proc)
 void ProcDecompiler::middleDecompile(UserProc *proc)
 {
     assert(m_callStack.back() == proc);
+    TraceScope trace("proc", "middleDecompile", proc->getName());
     Project *project = proc->getProg()->getProject();
 
     project->alertDecompileDebugPoint(proc, "before middleDecompile");
@@ -518,6 +525,14 @@ void ProcDecompiler::recursionGroupAnalysis(const std::shared_ptr<ProcSet> &grou
         return;
     }
 
+    QStringList groupNames;
+    if (Tracer::get().isEnabled()) {
+        for (UserProc *proc : *group) {
+            groupNames.append(proc->getName());
+        }
+    }
+
+    TraceScope trace("recursion", "recursionGroupAnalysis", groupNames.join(", "));
     LOG_MSG("Performing recursion group analysis for %1 recursive procedures: ", group->size());
     for (UserProc *proc : *group) {
         LOG_MSG("    %1", proc->getName());
@@ -548,6 +563,7 @@ void ProcDecompiler::recursionGroupAnalysis(const std::shared_ptr<ProcSet> &grou
 
 void ProcDecompiler::lateDecompile(UserProc *proc)
 {
+    TraceScope trace("proc", "lateDecompile", proc->getName());
     Project *project = proc->getProg()->getProject();
     project->alertDecompiling(proc);
     project->alertDecompileDebugPoint(proc, "before lateDecompile");
@@ -678,6 +694,32 @@ Function *ProcDecompiler::tryDecompileRecursive(Address entryAddr, Prog *prog, U
 }
 
 
+bool ProcDecompiler::isCalleeInScope(UserProc *callee, UserProc *caller)
+{
+    const DecompilationScope &scope = caller->getProg()->getProject()->getSettings()->m_scope;
+    if (scope.isUnrestricted()) {
+        return true;
+    }
+
+    int depth = 0;
+    if (!scope.isRoot(callee->getEntryAddress(), callee->getName())) {
+        auto callerIt = m_scopeDepths.find(caller);
+        depth         = (callerIt != m_scopeDepths.end() ? callerIt->second : 0) + 1;
+    }
+
+    if (!scope.isDepthInScope(depth)) {
+        return false;
+    }
+
+    auto it = m_scopeDepths.find(callee);
+    if (it == m_scopeDepths.end() || it->second > depth) {
+        m_scopeDepths[callee] = depth;
+    }
+
+    return true;
+}
+
+
 ProcStatus ProcDecompiler::decompileCallee(UserProc *callee, UserProc *proc)
 {
     Project *project = proc->getProg()->getProject();
@@ -715,6 +757,11 @@ ProcStatus ProcDecompiler::decompileCallee(UserProc *callee, UserProc *proc)
 
         proc->setStatus(ProcStatus::InCycle);
     }
+    else if (!isCalleeInScope(callee, proc)) {
+        // Treat the callee like a callee that is not decompiled with -nc
+        LOG_VERBOSE("Not decompiling callee '%1' of '%2': Outside of decompilation scope",
+                    callee->getName(), proc->getName());
+    }
     else {
         // No new cycle
         LOG_VERBOSE("Preparing to decompile callee '%1' of '%2'", callee->getName(),
@@ -38,6 +38,10 @@ private:
     /// \returns caller->getStatus();
     ProcStatus decompileCallee(UserProc *callee, UserProc *caller);
 
+    /// \returns true if \p callee of \p caller is within the decompilation scope.
+    /// Records the call depth of \p callee below the nearest root of the scope.
+    bool isCalleeInScope(UserProc *callee, UserProc *caller);
+
     /// Early decompile:
     /// sort CFG, number statements, dominator tree, place phi functions, number statements, first
     /// rename, propagation: ready for preserveds.
@@ -100,4 +104,7 @@ private:
      * each procedure is part of at most 1 recursion group.
      */
     std::unordered_map<UserProc *, std::shared_ptr<ProcSet>> m_recursionGroups;
+
+    /// Call depth of each visited proc below the nearest root of the decompilation scope
+    std::unordered_map<const UserProc *, int> m_scopeDepths;
 };
@@ -12,14 +12,13 @@
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Global.h"
+#include "boomerang/db/GlobalUseIndex.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/module/Module.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/decomp/CFGCompressor.h"
 #include "boomerang/decomp/UnusedReturnRemover.h"
 #include "boomerang/passes/PassManager.h"
-#include "boomerang/ssl/exp/Const.h"
-#include "boomerang/ssl/exp/Location.h"
 #include "boomerang/util/log/Log.h"
 
 
@@ -41,9 +40,10 @@ void ProgDecompiler::decompile()
     }
 
     // Just in case there are any Procs not in the call graph.
+    // Not done for restricted scopes, since those procs are out of scope by definition.
+    const Settings *settings = m_prog->getProject()->getSettings();
 
-    if (m_prog->getProject()->getSettings()->decodeMain &&
-        m_prog->getProject()->getSettings()->decodeChildren) {
+    if (settings->decodeMain && settings->decodeChildren && settings->m_scope.isUnrestricted()) {
         bool foundone = true;
 
         while (foundone) {
@@ -138,63 +138,29 @@ void ProgDecompiler::removeUnusedGlobals()
 {
     LOG_MSG("Removing unused global variables...");
 
-    // seach for used globals
-    std::list<SharedExp> usedGlobals;
+    const GlobalUseIndex &globalUses = m_prog->getGlobalUses();
+    const bool debugUnused           = m_prog->getProject()->getSettings()->debugUnused;
 
-    for (const auto &module : m_prog->getModuleList()) {
-        for (Function *func : *module) {
-            if (func->isLib()) {
-                continue;
-            }
-
-            UserProc *proc = static_cast<UserProc *>(func);
-            Location search(opGlobal, Terminal::get(opWild), proc);
-            // Search each statement in u, excepting implicit assignments (their uses don't count,
-            // since they don't really exist in the program representation)
-            StatementList stmts;
-            StatementList::iterator ss;
-            proc->getStatements(stmts);
-
-            for (SharedStmt s : stmts) {
-                if (s->isImplicit()) {
-                    continue; // Ignore the uses in ImplicitAssigns
-                }
-
-                bool found = s->searchAll(search, usedGlobals);
+    // Rebuild the globals set, only keeping the globals that are referenced
+    // by at least one procedure.
+    Prog::GlobalSet &globals = m_prog->getGlobals();
 
-                if (found && m_prog->getProject()->getSettings()->debugUnused) {
-                    LOG_VERBOSE("A global is used by stmt %1", s->getNumber());
-                }
+    for (auto it = globals.begin(); it != globals.end();) {
+        if (globalUses.isUsed((*it)->getName())) {
+            if (debugUnused) {
+                LOG_MSG(" %1 is used", (*it)->getName());
             }
-        }
-    }
 
-    // make a map to find a global by its name (could be a global var too)
-    QMap<QString, std::shared_ptr<Global>> namedGlobals;
-
-    for (auto &g : m_prog->getGlobals()) {
-        namedGlobals[g->getName()] = g;
-    }
-
-    // Rebuild the globals vector. Delete the unused globals only after re-inserting them
-    Prog::GlobalSet oldGlobals = m_prog->getGlobals();
-    m_prog->getGlobals().clear();
-
-    for (const SharedExp &e : usedGlobals) {
-        if (m_prog->getProject()->getSettings()->debugUnused) {
-            LOG_MSG(" %1 is used", e);
-        }
-
-        QString name(e->access<Const, 1>()->getStr());
-        auto &usedGlobal = namedGlobals[name];
-
-        if (usedGlobal) {
-            m_prog->getGlobals().insert(usedGlobal);
+            ++it;
         }
         else {
-            LOG_WARN("An expression refers to a nonexistent global");
+            it = globals.erase(it);
         }
     }
+
+    if (globalUses.getNumUsedGlobals() > globals.size()) {
+        LOG_WARN("An expression refers to a nonexistent global");
+    }
 }
 
 
@@ -218,6 +184,7 @@ void ProgDecompiler::fromSSAForm()
             UserProc *proc = static_cast<UserProc *>(pp);
             proc->numberStatements();
             PassManager::get()->executePass(PassID::FromSSAForm, proc);
+            m_prog->getGlobalUses().updateUses(proc);
         }
     }
 }
@@ -33,8 +33,11 @@
 #include "boomerang/ssl/statements/ReturnStatement.h"
 #include "boomerang/ssl/type/FuncType.h"
 #include "boomerang/ssl/type/NamedType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
+#include <set>
 #include <stack>
 
 
@@ -139,6 +142,8 @@ bool DefaultFrontEnd::disassembleEntryPoints()
 
 bool DefaultFrontEnd::disassembleAll()
 {
+    const DecompilationScope &scope = m_program->getProject()->getSettings()->m_scope;
+
     bool change = true;
     LOG_MSG("Looking for functions to disassemble...");
 
@@ -155,6 +160,11 @@ bool DefaultFrontEnd::disassembleAll()
                 if (userProc->isDecoded()) {
                     continue;
                 }
+                else if (!scope.isUnrestricted() &&
+                         !scope.isRoot(userProc->getEntryAddress(), userProc->getName())) {
+                    // Callees within the scope are disassembled on demand during decompilation
+                    continue;
+                }
 
                 // Not yet disassembled - do it now
                 if (!disassembleProc(userProc, userProc->getEntryAddress())) {
@@ -294,8 +304,14 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
             bbInsns.push_back(insn);
             const RTL::StmtList &sl = lifted.getFirstRTL()->getStatements();
 
-            for (auto ss = sl.begin(); ss != sl.end(); ++ss) {
-                SharedStmt s = *ss;
+            // Only the control transfer statement is needed to continue disassembling.
+            // The RTL is discarded afterwards; the proc is lifted by liftProc
+            // once it is actually decompiled.
+            if (!sl.empty()) {
+                assert(std::all_of(sl.begin(), std::prev(sl.end()),
+                                   [](const SharedStmt &stmt) { return stmt->isAssignment(); }));
+
+                const SharedStmt &s = sl.back();
                 s->setProc(proc); // let's do this really early!
 
                 if (m_refHints.find(lifted.getFirstRTL()->getAddress()) != m_refHints.end()) {
@@ -309,7 +325,6 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 }
 
                 s->simplify();
-                assert(s->isAssignment() || (std::next(ss) == sl.end()));
             }
 
             if (sl.empty()) {
@@ -553,6 +568,7 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
 
 bool DefaultFrontEnd::liftProc(UserProc *proc)
 {
+    IRArena::Scope arenaScope(proc->getIRArena());
     const bool ok = liftProcImpl(proc);
 
     // clean up
@@ -567,10 +583,9 @@ bool DefaultFrontEnd::liftProcImpl(UserProc *proc)
 {
     std::list<std::shared_ptr<CallStatement>> callList;
 
-    LowLevelCFG *cfg = proc->getProg()->getCFG();
     ProcCFG *procCFG = proc->getCFG();
 
-    for (BasicBlock *bb : *cfg) {
+    for (BasicBlock *bb : getProcBBs(proc)) {
         liftBB(bb, proc, callList);
     }
 
@@ -621,7 +636,7 @@ bool DefaultFrontEnd::liftProcImpl(UserProc *proc)
     procCFG->setEntryAndExitFragment(procCFG->getFragmentByAddr(proc->getEntryAddress()));
 
     IRFragment::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
 
     for (IRFragment *frag : *procCFG) {
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt != nullptr;
@@ -772,11 +787,28 @@ bool DefaultFrontEnd::liftInstruction(const MachineInstruction &insn, LiftedInst
         lifted.reset();
         lifted.addPart(std::make_unique<RTL>(insn.m_addr));
     }
+    else {
+        createRequestedCallees(lifted);
+    }
 
     return true;
 }
 
 
+void DefaultFrontEnd::createRequestedCallees(const LiftedInstruction &lifted)
+{
+    for (const std::shared_ptr<CallStatement> &call : lifted.getRequestedCallees()) {
+        Function *destProc = m_program->getOrCreateFunction(call->getFixedDest());
+
+        if (destProc == reinterpret_cast<Function *>(-1)) {
+            destProc = nullptr;
+        }
+
+        call->setDestProc(destProc);
+    }
+}
+
+
 bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
                              std::list<std::shared_ptr<CallStatement>> &callList)
 {
@@ -794,6 +826,8 @@ bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
             return false;
         }
 
+        createRequestedCallees(lifted);
+
         if (!lifted.isSimple()) {
             // this is bsf/bsr/rep* etc.
             std::list<LiftedInstructionPart> parts = lifted.use();
@@ -1311,6 +1345,53 @@ Address DefaultFrontEnd::getAddrOfLibraryThunk(const std::shared_ptr<CallStateme
 }
 
 
+std::vector<BasicBlock *> DefaultFrontEnd::getProcBBs(UserProc *proc) const
+{
+    LowLevelCFG *cfg    = m_program->getCFG();
+    BasicBlock *entryBB = cfg->getBBStartingAt(proc->getEntryAddress());
+    std::vector<BasicBlock *> procBBs;
+
+    if (!entryBB) {
+        // fall back to searching the whole program
+        for (BasicBlock *bb : *cfg) {
+            if (bb->getProc() == proc) {
+                procBBs.push_back(bb);
+            }
+        }
+
+        return procBBs;
+    }
+
+    // All BBs of the proc were tagged by tagFunctionBBs, so they are reachable from the entry BB.
+    std::set<BasicBlock *> visited;
+    std::stack<BasicBlock *> toVisit;
+    toVisit.push(entryBB);
+    visited.insert(entryBB);
+
+    while (!toVisit.empty()) {
+        BasicBlock *current = toVisit.top();
+        toVisit.pop();
+
+        if (current->getProc() == proc) {
+            procBBs.push_back(current);
+        }
+
+        for (BasicBlock *succ : current->getSuccessors()) {
+            if (visited.insert(succ).second) {
+                toVisit.push(succ);
+            }
+        }
+    }
+
+    // lift in address order, like iterating the whole CFG would
+    std::sort(procBBs.begin(), procBBs.end(), [](const BasicBlock *a, const BasicBlock *b) {
+        return a->getLowAddr() < b->getLowAddr();
+    });
+
+    return procBBs;
+}
+
+
 void DefaultFrontEnd::tagFunctionBBs(UserProc *proc)
 {
     std::set<BasicBlock *> visited;
@@ -135,6 +135,14 @@ private:
     /// \returns true iff \p exp is a memof that references the address of an imported function.
     bool refersToImportedFunction(const SharedExp &exp);
 
+    /// \returns all basic blocks of \p proc in address order.
+    std::vector<BasicBlock *> getProcBBs(UserProc *proc) const;
+
+    /// Creates the callees requested by the decoder while lifting \p lifted
+    /// and sets them as destinations of the corresponding calls.
+    /// \sa LiftedInstruction::requestCallee
+    void createRequestedCallees(const LiftedInstruction &lifted);
+
     /**
      * Add a synthetic return instruction and basic block (or a branch to the existing return
      * instruction).
@@ -9,6 +9,8 @@
 #pragma endregion License
 #include "LiftedInstruction.h"
 
+#include "boomerang/ssl/statements/CallStatement.h"
+
 
 LiftedInstructionPart::LiftedInstructionPart(std::unique_ptr<RTL> rtl)
     : m_rtl(std::move(rtl))
@@ -23,6 +25,7 @@ LiftedInstruction::LiftedInstruction()
 
 LiftedInstruction::LiftedInstruction(LiftedInstruction &&other)
     : m_parts(std::move(other.m_parts))
+    , m_requestedCallees(std::move(other.m_requestedCallees))
 {
 }
 
@@ -34,7 +37,8 @@ LiftedInstruction::~LiftedInstruction()
 
 LiftedInstruction &LiftedInstruction::operator=(LiftedInstruction &&other)
 {
-    m_parts = std::move(other.m_parts);
+    m_parts            = std::move(other.m_parts);
+    m_requestedCallees = std::move(other.m_requestedCallees);
 
     return *this;
 }
@@ -43,6 +47,7 @@ LiftedInstruction &LiftedInstruction::operator=(LiftedInstruction &&other)
 void LiftedInstruction::reset()
 {
     m_parts.clear();
+    m_requestedCallees.clear();
 }
 
 
@@ -84,3 +89,10 @@ std::unique_ptr<RTL> LiftedInstruction::useSingleRTL()
     m_parts.clear();
     return result;
 }
+
+
+void LiftedInstruction::requestCallee(const std::shared_ptr<CallStatement> &call)
+{
+    assert(call != nullptr);
+    m_requestedCallees.push_back(call);
+}
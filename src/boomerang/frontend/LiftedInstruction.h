@@ -13,6 +13,11 @@
 #include "boomerang/db/GraphNode.h"
 #include "boomerang/ssl/RTL.h"
 
+#include <vector>
+
+
+class CallStatement;
+
 
 /**
  * A single part of a lifted instruction.
@@ -72,6 +77,17 @@ public:
     /// consisting only of a single RTL.
     std::unique_ptr<RTL> useSingleRTL();
 
+    /// Request the front end to create the function called by the static call \p call
+    /// and to set it as the destination procedure of \p call.
+    void requestCallee(const std::shared_ptr<CallStatement> &call);
+
+    /// \returns all static calls whose callees have to be created by the front end.
+    const std::vector<std::shared_ptr<CallStatement>> &getRequestedCallees() const
+    {
+        return m_requestedCallees;
+    }
+
 private:
     std::list<LiftedInstructionPart> m_parts;
+    std::vector<std::shared_ptr<CallStatement>> m_requestedCallees;
 };
@@ -49,6 +49,13 @@ public:
     std::vector<SharedExp> m_operands;
     QString m_templateName; ///< Name of SSL IR template (e.g. REPSTOSB.rm8 or MOVSX.r32.rm8)
 
+    /// Decoder specific ID of the SSL IR template, or INVALID_TEMPLATE if the decoder
+    /// does not assign template IDs.
+    uint32 m_templateID = INVALID_TEMPLATE;
+
+public:
+    static constexpr uint32 INVALID_TEMPLATE = static_cast<uint32>(-1);
+
 public:
     /// Enables or disables the membership in a certain group. Does not affect other groups.
     void setGroup(MIGroup groupID, bool enabled);
@@ -26,6 +26,12 @@ class RTLInstDict;
  * Base class for machine instruction decoders.
  * Decoders disassemble raw bytes to MachineInstructions
  * and lift them to statement lists (RTLs).
+ *
+ * Thread safety: After \ref initialize has returned, all const member functions
+ * (in particular \ref disassembleInstruction and \ref liftInstruction) must be safe to call
+ * concurrently from multiple threads. Decoders must therefore not modify the program
+ * while disassembling or lifting; side effects that the front end has to apply
+ * (e.g. creating the callees of static calls) are returned in the \ref LiftedInstruction instead.
  */
 class BOOMERANG_API IDecoder
 {
@@ -47,12 +53,14 @@ public:
      * \returns true iff disassembling the instruction was successful.
      */
     [[nodiscard]] virtual bool disassembleInstruction(Address pc, ptrdiff_t delta,
-                                                      MachineInstruction &result) = 0;
+                                                      MachineInstruction &result) const = 0;
 
-    /// Lift a disassembled instruction to an RTL
+    /// Lift a disassembled instruction to an RTL.
+    /// Callees of static calls are not created by the decoder, but requested
+    /// via \ref LiftedInstruction::requestCallee.
     /// \returns true if lifting the instruction was succesful.
     [[nodiscard]] virtual bool liftInstruction(const MachineInstruction &insn,
-                                               LiftedInstruction &lifted) = 0;
+                                               LiftedInstruction &lifted) const = 0;
 
     /// \returns machine-specific register name given its index
     virtual QString getRegNameByNum(RegNum regNum) const = 0;
@@ -41,6 +41,7 @@ public:
     [[nodiscard]] virtual bool disassembleEntryPoints() = 0;
 
     /// Disassemble all functions until there are no un-disassembled functions left.
+    /// If the decompilation scope is restricted, only the roots of the scope are disassembled.
     /// \returns true on success.
     [[nodiscard]] virtual bool disassembleAll() = 0;
 
@@ -57,6 +58,8 @@ public:
     [[nodiscard]] virtual bool disassembleProc(UserProc *proc, Address addr) = 0;
 
     /// Lift all instructions for a proc.
+    /// Disassembly only records the low level CFG; a proc is lifted
+    /// when it is decompiled (see StatementInitPass).
     /// \returns true on success, false on failure
     [[nodiscard]] virtual bool liftProc(UserProc *proc) = 0;
 
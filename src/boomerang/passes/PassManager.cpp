@@ -38,9 +38,12 @@
 #include "boomerang/passes/middle/PreservationAnalysisPass.h"
 #include "boomerang/passes/middle/SPPreservationPass.h"
 #include "boomerang/passes/middle/StrengthReductionReversalPass.h"
+#include "boomerang/util/IRArena.h"
+#include "boomerang/util/Tracer.h"
 #include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
 #include <cassert>
 
 
@@ -50,6 +53,7 @@ static PassManager g_passManager;
 PassManager::PassManager()
 {
     m_passes.resize(static_cast<size_t>(PassID::NUM_PASSES));
+    m_numExecutions.resize(static_cast<size_t>(PassID::NUM_PASSES), 0);
 
     registerPass(PassID::Dominators, std::make_unique<DominatorPass>());
     registerPass(PassID::PhiPlacement, std::make_unique<PhiPlacementPass>());
@@ -108,6 +112,10 @@ bool PassManager::executePass(IPass *pass, UserProc *proc)
     assert(pass != nullptr);
     LOG_VERBOSE("Executing pass '%1' for '%2'", pass->getName(), proc->getName());
 
+    m_numExecutions[static_cast<size_t>(pass->getType())]++;
+
+    TraceScope trace("pass", pass->getName(), proc->getName());
+    IRArena::Scope arenaScope(proc->getIRArena());
     const bool change = pass->execute(proc);
 
     if (Log::getOrCreateLog().getLogLevel() >= LogLevel::Verbose1) {
@@ -119,6 +127,23 @@ bool PassManager::executePass(IPass *pass, UserProc *proc)
 }
 
 
+int PassManager::getNumExecutions(PassID passID) const
+{
+    if (!Util::inRange(static_cast<size_t>(passID), static_cast<size_t>(0),
+                       m_numExecutions.size())) {
+        return 0;
+    }
+
+    return m_numExecutions[static_cast<size_t>(passID)];
+}
+
+
+void PassManager::resetStatistics()
+{
+    std::fill(m_numExecutions.begin(), m_numExecutions.end(), 0);
+}
+
+
 void PassManager::registerPass(PassID passID, std::unique_ptr<IPass> pass)
 {
     assert(Util::inRange(static_cast<size_t>(passID), static_cast<size_t>(0), m_passes.size()));
@@ -44,9 +44,17 @@ public:
     bool executePass(IPass *pass, UserProc *proc);
     bool executePass(PassID passID, UserProc *proc);
 
+    /// \returns how often the pass \p passID was executed
+    /// since the last call to \ref resetStatistics
+    int getNumExecutions(PassID passID) const;
+
+    /// Reset the execution counts of all passes.
+    void resetStatistics();
+
 private:
     void registerPass(PassID passType, std::unique_ptr<IPass> pass);
 
 private:
     std::vector<std::unique_ptr<IPass>> m_passes;
+    std::vector<int> m_numExecutions; ///< Number of executions, indexed by PassID
 };
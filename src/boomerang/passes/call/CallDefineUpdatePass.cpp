@@ -17,6 +17,7 @@
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/ImplicitAssign.h"
 #include "boomerang/ssl/statements/ReturnStatement.h"
+#include "boomerang/util/LocationSet.h"
 #include "boomerang/util/StatementList.h"
 #include "boomerang/util/log/Log.h"
 
@@ -71,6 +72,12 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc,
     StatementList newDefines(callStmt->getDefines());
     callStmt->getDefines().clear();
 
+    // Left hand sides of newDefines, to avoid a linear search for every location
+    LocationSet definedLocs;
+    for (const SharedStmt &def : newDefines) {
+        definedLocs.insert(def->as<Assignment>()->getLeft());
+    }
+
     if (callee && callStmt->getCalleeReturn()) {
         assert(!callee->isLib());
         const StatementList
@@ -86,8 +93,9 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc,
 
             SharedType ty = as->getType();
 
-            if (!newDefines.existsOnLeft(loc)) {
+            if (!definedLocs.contains(loc)) {
                 newDefines.append(std::make_shared<ImplicitAssign>(ty, loc));
+                definedLocs.insert(loc);
             }
         }
     }
@@ -98,11 +106,12 @@ bool CallDefineUpdatePass::updateCallDefines(UserProc *proc,
                 continue; // Filtered out
             }
 
-            if (!newDefines.existsOnLeft(loc)) {
+            if (!definedLocs.contains(loc)) {
                 std::shared_ptr<ImplicitAssign> as(new ImplicitAssign(loc->clone()));
                 as->setProc(proc);
                 as->setFragment(callStmt->getFragment());
                 newDefines.append(as);
+                definedLocs.insert(as->getLeft());
             }
         }
     }
@@ -51,7 +51,11 @@ bool BlockVarRenamePass::execute(UserProc *proc)
     }
 
     const FragIndex entryIdx = proc->getDataFlow()->fragToIdx(entryFrag);
-    const bool changed       = renameBlockVars(proc, entryIdx);
+    if (entryIdx == INDEX_INVALID) {
+        return false;
+    }
+
+    const bool changed = renameBlockVars(proc, entryIdx);
 
 #ifndef NDEBUG
     for (auto &[var, stack] : stacks) {
@@ -76,7 +80,7 @@ bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
 
     // For each statement S in block n
     IRFragment::RTLIterator rit;
-    StatementList::iterator sit;
+    RTL::iterator sit;
     IRFragment *frag = proc->getDataFlow()->idxToFrag(n);
 
     for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt; stmt = frag->getNextStmt(rit, sit)) {
@@ -149,15 +153,9 @@ bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
         }
     }
 
-    // For each child X of n
-    // Note: linear search!
-    const std::size_t numFrags = proc->getCFG()->getNumFragments();
-
-    for (FragIndex X = 0; X < numFrags; ++X) {
-        const FragIndex idom = proc->getDataFlow()->getIdom(X);
-        if (idom == n && X != n) { // if 'n' is immediate dominator of X
-            renameBlockVars(proc, X);
-        }
+    // For each child X of n in the dominator tree
+    for (FragIndex X : proc->getDataFlow()->getAnalysis()->getDomChildren(n)) {
+        renameBlockVars(proc, X);
     }
 
     // NOTE: Because of the need to pop childless calls from the Stacks, it is important in my
@@ -165,7 +163,7 @@ bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
     // (It is not important in Appel's algorithm, since he always pushes a definition
     // for every variable defined on the Stacks).
     IRFragment::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
+    RTL::reverse_iterator srit;
 
     for (SharedStmt S = frag->getLastStmt(rrit, srit); S; S = frag->getPrevStmt(rrit, srit)) {
         popDefinitions(S, assumeABICompliance);
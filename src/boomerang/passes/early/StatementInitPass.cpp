@@ -34,7 +34,7 @@ bool StatementInitPass::execute(UserProc *proc)
 
     for (IRFragment *frag : *proc->getCFG()) {
         IRFragment::RTLIterator rit;
-        StatementList::iterator sit;
+        RTL::iterator sit;
 
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt != nullptr;
              stmt            = frag->getNextStmt(rit, sit)) {
@@ -29,14 +29,13 @@ StatementPropagationPass::StatementPropagationPass()
 
 bool StatementPropagationPass::execute(UserProc *proc)
 {
-    StatementList stmts;
-    proc->getStatements(stmts);
+    const StatementRange stmts = proc->getStatements();
 
     // count the number of times each assignment LHS would be propagated somewhere
     std::map<SharedExp, int, lessExpStar> destCounts;
 
     // Also maintain a set of locations which are used by phi statements
-    for (SharedStmt s : stmts) {
+    for (const SharedStmt &s : stmts) {
         ExpDestCounter edc(destCounts);
         StmtDestCounter sdc(&edc);
         s->accept(&sdc);
@@ -46,7 +45,7 @@ bool StatementPropagationPass::execute(UserProc *proc)
     // (these must be propagated even if it results in extra locals)
     bool change = false;
 
-    for (SharedStmt s : stmts) {
+    for (const SharedStmt &s : stmts) {
         if (!s->isPhi()) {
             change |= s->propagateFlagsToThis();
         }
@@ -54,7 +53,7 @@ bool StatementPropagationPass::execute(UserProc *proc)
 
     // Finally the actual propagation
     const int propMaxDepth = proc->getProg()->getProject()->getSettings()->propMaxDepth;
-    for (SharedStmt s : stmts) {
+    for (const SharedStmt &s : stmts) {
         if (!s->isPhi()) {
             change |= s->propagateToThis(propMaxDepth, &destCounts);
         }
@@ -203,7 +203,7 @@ bool BranchAnalysisPass::isOnlyBranch(IRFragment *frag) const
         return false;
     }
 
-    StatementList::reverse_iterator sIt;
+    RTL::reverse_iterator sIt;
     IRFragment::RTLRIterator rIt;
     bool last = true;
 
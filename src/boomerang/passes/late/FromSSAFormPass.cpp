@@ -340,7 +340,7 @@ void FromSSAFormPass::removeSubscriptsFromSymbols(UserProc *proc)
     // this will potentially change the ordering of entries, need to copy the map
     UserProc::SymbolMap sm2 = proc->getSymbolMap(); // Object copy
 
-    proc->getSymbolMap().clear();
+    proc->clearSymbolMap();
     ExpSSAXformer esx(proc);
 
     for (const auto &[first, second] : sm2) {
@@ -44,7 +44,7 @@ bool ImplicitPlacementPass::makeSymbolsImplicit(UserProc *proc)
 {
     // Copy the whole map; necessary because the keys (Exps) change
     UserProc::SymbolMap sm2 = proc->getSymbolMap();
-    proc->getSymbolMap().clear();
+    proc->clearSymbolMap();
     ImplicitConverter ic(proc->getCFG());
 
     for (const auto &[first, second] : sm2) {
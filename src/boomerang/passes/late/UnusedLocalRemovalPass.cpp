@@ -129,26 +129,7 @@ bool UnusedLocalRemovalPass::execute(UserProc *proc)
     }
 
     // Finally, remove them from locals, so they don't get declared
-    for (QString localName : removes) {
-        proc->getLocals().erase(localName);
-    }
-
-    // Also remove them from the symbols, since symbols are a superset of locals at present
-    for (UserProc::SymbolMap::iterator sm = proc->getSymbolMap().begin();
-         sm != proc->getSymbolMap().end();) {
-        SharedExp mapsTo = sm->second;
-
-        if (mapsTo->isLocal()) {
-            QString tmpName = mapsTo->access<Const, 1>()->getStr();
-
-            if (removes.find(tmpName) != removes.end()) {
-                sm = proc->getSymbolMap().erase(sm);
-                continue;
-            }
-        }
-
-        ++sm;
-    }
+    proc->removeLocals(removes);
 
     proc->getProg()->getProject()->alertDecompileDebugPoint(proc, "After removing unused locals");
     return true;
@@ -77,11 +77,7 @@ bool UnusedParamRemovalPass::execute(UserProc *proc)
             }
 
             // Check if it is in the symbol map. If so, delete it; a local will be created later
-            UserProc::SymbolMap::iterator ss = proc->getSymbolMap().find(param);
-
-            if (ss != proc->getSymbolMap().end()) {
-                proc->getSymbolMap().erase(ss); // Kill the symbol
-            }
+            proc->removeSymbol(param);
 
             proc->getSignature()->removeParameter(param); // Also remove from the signature
             proc->getCFG()->removeImplicitAssign(
@@ -11,16 +11,11 @@
 
 
 #include "boomerang/passes/Pass.h"
-#include "boomerang/ssl/statements/Statement.h"
-
-#include <map>
 
 
 /// Remove unused statements
 class UnusedStatementRemovalPass final : public IPass
 {
-    typedef std::map<SharedStmt, int> RefCounter;
-
 public:
     UnusedStatementRemovalPass();
 
@@ -29,11 +24,9 @@ public:
     bool execute(UserProc *proc) override;
 
 private:
-    /// Count references to the things that are under SSA control.
-    /// For each SSA subscripting, increment a counter for that definition
-    void updateRefCounts(UserProc *proc, RefCounter &refCounts);
-
-    void remUnusedStmtEtc(UserProc *proc, RefCounter &refCounts);
+    /// Remove all assignments whose definitions are not used by any live statement.
+    /// \sa DeadCodeEliminator
+    void removeUnusedStatements(UserProc *proc);
 
     /// Remove statements of the form x := x
     bool removeNullStatements(UserProc *proc);
@@ -16,8 +16,10 @@
 #include "boomerang/ssl/exp/RefExp.h"
 #include "boomerang/ssl/exp/Terminal.h"
 #include "boomerang/ssl/exp/Unary.h"
+#include "boomerang/ssl/statements/Assign.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
-#include "boomerang/util/StatementList.h"
+#include "boomerang/util/LocationSet.h"
+#include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
 
 
@@ -29,137 +31,122 @@ AssignRemovalPass::AssignRemovalPass()
 
 bool AssignRemovalPass::execute(UserProc *proc)
 {
-    bool change = false;
-    change |= removeSpAssigns(proc);
-    change |= removeMatchingAssigns(proc, Unary::get(opTemp, Terminal::get(opWildStrConst)));
-    change |= removeMatchingAssigns(proc, Terminal::get(opPC));
-    return change;
-}
-
-
-bool AssignRemovalPass::removeSpAssigns(UserProc *proc)
-{
-    // if there are no uses of sp other than sp{-} in the whole procedure,
-    // we can safely remove all assignments to sp, this will make the output
-    // more readable for human eyes.
+    // If there are no uses of sp other than sp{-} in the whole procedure,
+    // we can safely remove all assignments to sp; the same holds for temporaries and %pc.
+    // This will make the output more readable for human eyes and makes short circuit
+    // analysis easier.
+    // Assignments are only ever removed all at once, since collectors of calls and returns
+    // may still refer to individual definitions, and they are not counted as uses here.
+    const SharedExp sp  = Location::regOf(Util::getStackRegisterIndex(proc->getProg()));
+    const SharedExp tmp = Unary::get(opTemp, Terminal::get(opWildStrConst));
+    const SharedExp pc  = Terminal::get(opPC);
+
+    // Find the assignments to sp, temporaries and %pc and their uses with a single scan.
+    // Uses in statements that are removed themselves are not counted, as if the locations
+    // were removed one after the other (first sp, then temporaries, then %pc).
+    bool foundSp  = false;
+    bool foundTmp = false;
+    bool foundPc  = false;
+    bool spUsed   = false;
+    std::vector<StmtUses> uses;
+
+    for (const SharedStmt &stmt : proc->getStatements()) {
+        StmtUses stmtUses{ stmt, Loc::None, false, false };
 
-    SharedExp sp  = Location::regOf(Util::getStackRegisterIndex(proc->getProg()));
-    bool foundone = false;
-
-    StatementList stmts;
-    proc->getStatements(stmts);
-
-    for (SharedStmt stmt : stmts) {
-        if (stmt->isAssign() && (*stmt->as<Assign>()->getLeft() == *sp)) {
-            foundone = true;
+        if (stmt->isAssign()) {
+            const SharedConstExp lhs = stmt->as<Assign>()->getLeft();
+            stmtUses.def             = defines(lhs, sp, tmp, pc);
         }
+        else if (stmt->isPhi()) {
+            const SharedConstExp lhs = stmt->as<PhiAssign>()->getLeft();
+            const Loc def            = defines(lhs, sp, tmp, pc);
+            stmtUses.def             = (def != Loc::Sp) ? def : Loc::None;
+        }
+
+        foundSp |= (stmtUses.def == Loc::Sp);
+        foundTmp |= (stmtUses.def == Loc::Tmp);
+        foundPc |= (stmtUses.def == Loc::Pc);
 
         LocationSet refs;
         stmt->addUsedLocs(refs);
 
         for (const SharedExp &rr : refs) {
-            if (rr->isSubscript() && (*rr->getSubExp1() == *sp)) {
-                SharedStmt def = rr->access<RefExp>()->getDef();
-
-                if (def && (def->getProc() == proc)) {
-                    return false;
-                }
+            if (!rr->isSubscript()) {
+                continue;
             }
-        }
-    }
 
-    if (!foundone) {
-        return false;
-    }
-
-    proc->getProg()->getProject()->alertDecompileDebugPoint(
-        proc, "Before removing stack pointer assigns.");
-
-    for (auto &stmt : stmts) {
-        if (stmt->isAssign()) {
-            std::shared_ptr<Assign> a = stmt->as<Assign>();
+            const SharedStmt def = rr->access<RefExp>()->getDef();
+            if (!def || def->getProc() != proc) {
+                continue;
+            }
 
-            if (*a->getLeft() == *sp) {
-                proc->removeStatement(a);
+            if (*rr->getSubExp1() == *sp) {
+                spUsed = true;
+            }
+            else if (!stmt->isPhi()) {
+                // uses of temporaries and %pc in phis are not real uses
+                stmtUses.usesTmp |= (*rr->getSubExp1() == *tmp);
+                stmtUses.usesPc |= (*rr->getSubExp1() == *pc);
             }
         }
-    }
-
-    proc->getProg()->getProject()->alertDecompileDebugPoint(
-        proc, "After removing stack pointer assigns.");
-    return true;
-}
-
-
-bool AssignRemovalPass::removeMatchingAssigns(UserProc *proc, SharedExp e)
-{
-    // if there are no uses of %flags in the whole procedure,
-    // we can safely remove all assignments to %flags, this will make the output
-    // more readable for human eyes and makes short circuit analysis easier.
 
-    bool foundone = false;
+        uses.push_back(stmtUses);
+    }
 
-    StatementList stmts;
-    proc->getStatements(stmts);
+    const bool removeSp = foundSp && !spUsed;
+    bool removeTmp      = foundTmp;
+    bool removePc       = foundPc;
 
-    for (auto stmt : stmts) {
-        if (stmt->isAssign() && (*stmt->as<Assign>()->getLeft() == *e)) {
-            foundone = true;
+    for (const StmtUses &stmtUses : uses) {
+        if (removeSp && stmtUses.def == Loc::Sp) {
+            continue;
         }
 
-        if (stmt->isPhi()) {
-            if (*stmt->as<PhiAssign>()->getLeft() == *e) {
-                foundone = true;
-            }
+        removeTmp &= !stmtUses.usesTmp;
+    }
 
+    for (const StmtUses &stmtUses : uses) {
+        if ((removeSp && stmtUses.def == Loc::Sp) || (removeTmp && stmtUses.def == Loc::Tmp)) {
             continue;
         }
 
-        LocationSet refs;
-        stmt->addUsedLocs(refs);
-
-        for (const SharedExp &rr : refs) {
-            if (rr->isSubscript() && (*rr->getSubExp1() == *e)) {
-                SharedStmt def = rr->access<RefExp>()->getDef();
-
-                if (def && (def->getProc() == proc)) {
-                    return false;
-                }
-            }
-        }
+        removePc &= !stmtUses.usesPc;
     }
 
-    if (!foundone) {
+    if (!removeSp && !removeTmp && !removePc) {
         return false;
     }
 
-    QString msg;
-    OStream str(&msg);
-    str << "Before removing matching assigns (" << e << ").";
+    Project *project = proc->getProg()->getProject();
+    project->alertDecompileDebugPoint(proc, "Before removing unused assigns.");
 
-    proc->getProg()->getProject()->alertDecompileDebugPoint(proc, qPrintable(msg));
+    int numRemoved = 0;
+    for (const StmtUses &stmtUses : uses) {
+        if ((removeSp && stmtUses.def == Loc::Sp) || (removeTmp && stmtUses.def == Loc::Tmp) ||
+            (removePc && stmtUses.def == Loc::Pc)) {
+            proc->removeStatement(stmtUses.stmt);
+            numRemoved++;
+        }
+    }
 
-    for (auto &stmt : stmts) {
-        if ((stmt)->isAssign()) {
-            std::shared_ptr<Assign> a = stmt->as<Assign>();
+    project->alertDecompileDebugPoint(proc, "After removing unused assigns.");
+    LOG_VERBOSE("Removed %1 unused assigns in '%2'", numRemoved, proc->getName());
+    return true;
+}
 
-            if (*a->getLeft() == *e) {
-                proc->removeStatement(a);
-            }
-        }
-        else if ((stmt)->isPhi()) {
-            std::shared_ptr<PhiAssign> a = stmt->as<PhiAssign>();
 
-            if (*a->getLeft() == *e) {
-                proc->removeStatement(a);
-            }
-        }
+AssignRemovalPass::Loc AssignRemovalPass::defines(const SharedConstExp &lhs, const SharedExp &sp,
+                                                  const SharedExp &tmp, const SharedExp &pc)
+{
+    if (*lhs == *sp) {
+        return Loc::Sp;
+    }
+    else if (*lhs == *tmp) {
+        return Loc::Tmp;
+    }
+    else if (*lhs == *pc) {
+        return Loc::Pc;
     }
 
-    msg.clear();
-    str << "After removing matching assigns (" << e << ").";
-    proc->getProg()->getProject()->alertDecompileDebugPoint(proc, qPrintable(msg));
-    LOG_VERBOSE(msg);
-
-    return true;
+    return Loc::None;
 }
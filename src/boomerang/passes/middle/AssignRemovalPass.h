@@ -11,15 +11,31 @@
 
 
 #include "boomerang/passes/Pass.h"
+#include "boomerang/ssl/statements/Statement.h"
 
-#include <memory>
 
-using SharedExp = std::shared_ptr<class Exp>;
-
-
-/// Removes unused or tautological assignments.
+/// Removes all assignments to the stack pointer, to temporaries and to %pc,
+/// if the respective location is not used at all.
 class AssignRemovalPass final : public IPass
 {
+    /// The locations whose assignments are removed
+    enum class Loc : uint8_t
+    {
+        None,
+        Sp,
+        Tmp,
+        Pc
+    };
+
+    /// Which of the locations a statement defines and uses
+    struct StmtUses
+    {
+        SharedStmt stmt;
+        Loc def;
+        bool usesTmp;
+        bool usesPc;
+    };
+
 public:
     AssignRemovalPass();
 
@@ -28,8 +44,7 @@ public:
     bool execute(UserProc *proc) override;
 
 private:
-    /// Preservations only for the stack pointer
-    bool removeSpAssigns(UserProc *proc);
-
-    bool removeMatchingAssigns(UserProc *proc, SharedExp exp);
+    /// \returns which of \p sp, \p tmp and \p pc the left hand side \p lhs matches.
+    static Loc defines(const SharedConstExp &lhs, const SharedExp &sp, const SharedExp &tmp,
+                       const SharedExp &pc);
 };
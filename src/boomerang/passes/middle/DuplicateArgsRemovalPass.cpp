@@ -24,7 +24,7 @@ DuplicateArgsRemovalPass::DuplicateArgsRemovalPass()
 bool DuplicateArgsRemovalPass::execute(UserProc *proc)
 {
     IRFragment::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
+    RTL::reverse_iterator srit;
 
     for (IRFragment *frag : *proc->getCFG()) {
         std::shared_ptr<CallStatement> c = std::dynamic_pointer_cast<CallStatement>(
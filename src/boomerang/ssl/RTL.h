@@ -13,8 +13,8 @@
 #include "boomerang/ssl/statements/Statement.h"
 #include "boomerang/util/Address.h"
 
-#include <list>
 #include <memory>
+#include <vector>
 
 
 class OStream;
@@ -29,7 +29,7 @@ class OStream;
 class BOOMERANG_API RTL
 {
 public:
-    typedef std::list<SharedStmt> StmtList;
+    typedef std::vector<SharedStmt> StmtList;
 
 public:
     typedef StmtList::size_type size_type;
@@ -98,7 +98,7 @@ public:
 
     const StmtList &getStatements() const { return m_stmts; }
 
-    // delegates to std::list
+    // delegates to std::vector
 public:
     bool empty() const { return m_stmts.empty(); }
 
@@ -119,10 +119,10 @@ public:
     const_reverse_iterator rbegin() const { return m_stmts.rbegin(); }
     const_reverse_iterator rend() const { return m_stmts.rend(); }
 
-    void pop_front() { m_stmts.pop_front(); }
+    void pop_front() { m_stmts.erase(m_stmts.begin()); }
     void pop_back() { m_stmts.pop_back(); }
 
-    void push_front(const value_type &val) { m_stmts.push_front(val); }
+    void push_front(const value_type &val) { m_stmts.insert(m_stmts.begin(), val); }
 
     void insert(iterator where, const value_type &val);
     void clear() { m_stmts.clear(); }
@@ -135,4 +135,4 @@ private:
 };
 
 using SharedRTL = std::shared_ptr<RTL>;
-using RTLList   = std::list<std::unique_ptr<RTL>>;
+using RTLList   = std::vector<std::unique_ptr<RTL>>;
@@ -111,7 +111,7 @@ void RTLInstDict::print(OStream &os /*= std::cout*/)
 
 
 std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const QString &name, Address natPC,
-                                                 const std::vector<SharedExp> &args)
+                                                 const std::vector<SharedExp> &args) const
 {
     // TODO try to retrieve fast instruction mappings
     // before trying the verbose instructions
@@ -123,14 +123,14 @@ std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const QString &name, Address na
         return nullptr; // instruction not found
     }
 
-    TableEntry &entry(dict_entry->second);
+    const TableEntry &entry(dict_entry->second);
     return instantiateRTL(entry.m_rtl, natPC, entry.m_params, args);
 }
 
 
 std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const RTL &existingRTL, Address natPC,
                                                  const std::list<QString> &params,
-                                                 const std::vector<SharedExp> &args)
+                                                 const std::vector<SharedExp> &args) const
 {
     assert(params.size() == args.size());
 
@@ -196,7 +196,7 @@ std::unique_ptr<RTL> RTLInstDict::instantiateRTL(const RTL &existingRTL, Address
 }
 
 
-void RTLInstDict::fixSuccessorForStmt(const SharedStmt &stmt)
+void RTLInstDict::fixSuccessorForStmt(const SharedStmt &stmt) const
 {
     if (!stmt->isAssign()) {
         return;
@@ -69,7 +69,7 @@ public:
      * \param args    the actual values of the instruction parameters
      */
     std::unique_ptr<RTL> instantiateRTL(const QString &name, Address pc,
-                                        const std::vector<SharedExp> &args);
+                                        const std::vector<SharedExp> &args) const;
 
     RegDB *getRegDB();
     const RegDB *getRegDB() const;
@@ -90,7 +90,7 @@ private:
      */
     std::unique_ptr<RTL> instantiateRTL(const RTL &rtls, Address pc,
                                         const std::list<QString> &params,
-                                        const std::vector<SharedExp> &args);
+                                        const std::vector<SharedExp> &args) const;
 
     /**
      * Appends one RTL to the dictionary, or adds it to idict if an
@@ -107,7 +107,7 @@ private:
     void print(OStream &os);
 
     /// Replace opSuccessor by real semantics in \p stmt.
-    void fixSuccessorForStmt(const SharedStmt &stmt);
+    void fixSuccessorForStmt(const SharedStmt &stmt) const;
 
 private:
     /// Print messages when reading an SSL file or when instantiaing an instruction
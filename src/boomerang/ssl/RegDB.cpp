@@ -35,6 +35,11 @@ void RegDB::clear()
     m_regNums.clear();
     m_regInfo.clear();
     m_specialRegInfo.clear();
+    m_parent.clear();
+    m_offsetInParent.clear();
+    m_children.clear();
+    m_specialChildren.clear();
+    m_overlaps.clear();
 }
 
 
@@ -46,14 +51,13 @@ bool RegDB::isRegDefined(const QString &regName) const
 
 bool RegDB::isRegNumDefined(RegNum regNum) const
 {
-    return m_regInfo.find(RegID(RegType::Invalid, regNum, 0)) != m_regInfo.end();
+    return findReg(regNum) != nullptr;
 }
 
 
 const Register *RegDB::getRegByNum(RegNum regNum) const
 {
-    const auto it = m_regInfo.find(RegID(RegType::Invalid, regNum, 0));
-    return it != m_regInfo.end() ? &it->second : nullptr;
+    return findReg(regNum);
 }
 
 
@@ -86,15 +90,15 @@ RegID RegDB::getRegIDByName(const QString &name) const
 
 QString RegDB::getRegNameByNum(RegNum regNum) const
 {
-    const auto it = m_regInfo.find(RegID(RegType::Invalid, regNum, 0));
-    return it != m_regInfo.end() ? it->second.getName() : "";
+    const Register *reg = findReg(regNum);
+    return reg ? reg->getName() : "";
 }
 
 
 int RegDB::getRegSizeByNum(RegNum regNum) const
 {
-    const auto iter = m_regInfo.find(RegID(RegType::Invalid, regNum, 0));
-    return iter != m_regInfo.end() ? iter->second.getSize() : 32;
+    const Register *reg = findReg(regNum);
+    return reg ? reg->getSize() : 32;
 }
 
 
@@ -120,19 +124,27 @@ bool RegDB::createReg(RegType regType, RegNum regNum, const QString &name, int s
         return true;
     }
 
-    const auto it = m_regInfo.find(regID);
-    if (it != m_regInfo.end()) {
+    const Register *existing = findReg(regNum);
+    if (existing != nullptr) {
         // register alias: only name can be different
-        const Register &reg = it->second;
-        if (regType != reg.getRegType() || size != reg.getSize()) {
+        if (regType != existing->getRegType() || size != existing->getSize()) {
             m_regNums.erase(name);
             return false;
         }
+
+        return true;
     }
-    else {
-        m_regInfo.insert({ regID, Register(regID, name) });
+
+    if (regNum >= m_regInfo.size()) {
+        const std::size_t newSize = regNum + 1;
+        m_regInfo.resize(newSize, Register(RegIDSpecial, ""));
+        m_parent.resize(newSize, RegNumSpecial);
+        m_offsetInParent.resize(newSize, 0);
+        m_children.resize(newSize);
+        m_overlaps.resize(newSize);
     }
 
+    m_regInfo[regNum] = Register(regID, name);
     return true;
 }
 
@@ -145,27 +157,49 @@ bool RegDB::createRegRelation(const QString &parent, const QString &child, int o
     else if (!isRegDefined(parent) || !isRegDefined(child)) {
         return false;
     }
-    else if (getRegNumByName(parent) == RegNumSpecial) {
+
+    const RegNum parentNum = getRegNumByName(parent);
+    const RegNum childNum  = getRegNumByName(child);
+
+    if (parentNum == RegNumSpecial) {
         // parent is a special register -> fail
         return false;
     }
-    else if (m_parent.find(child) != m_parent.end() ||
-             m_offsetInParent.find(child) != m_offsetInParent.end() ||
-             (m_children.find(parent) != m_children.end() &&
-              m_children.at(parent).find(offsetInParent) != m_children.at(parent).end())) {
+    else if (parentNum == childNum) {
+        // parent and child are aliases of the same register
+        return false;
+    }
+    else if (m_children[parentNum].find(offsetInParent) != m_children[parentNum].end()) {
+        // relation already exists
+        return false;
+    }
+    else if (childNum == RegNumSpecial) {
+        if (!m_specialChildren.insert(child).second) {
+            // relation already exists
+            return false;
+        }
+
+        // Special registers cannot be assigned to via regOf, so they do not take part
+        // in overlapped register processing.
+        m_children[parentNum][offsetInParent] = RegNumSpecial;
+        return true;
+    }
+    else if (m_parent[childNum] != RegNumSpecial) {
         // relation already exists
         return false;
     }
 
-    m_parent[child]                    = parent;
-    m_offsetInParent[child]            = offsetInParent;
-    m_children[parent][offsetInParent] = child;
+    m_parent[childNum]                    = parentNum;
+    m_offsetInParent[childNum]            = offsetInParent;
+    m_children[parentNum][offsetInParent] = childNum;
+
+    updateOverlaps();
     return true;
 }
 
 
 std::unique_ptr<RTL> RegDB::processOverlappedRegs(const std::shared_ptr<Assignment> &stmt,
-                                                  const std::set<RegNum> &usedRegs) const
+                                                  const RegNumSet &usedRegs) const
 {
     assert(stmt != nullptr);
     SharedConstExp lhs = stmt->getLeft();
@@ -181,87 +215,82 @@ std::unique_ptr<RTL> RegDB::processOverlappedRegs(const std::shared_ptr<Assignme
 
     std::unique_ptr<RTL> result = std::make_unique<RTL>(Address::ZERO);
 
-    try {
-        // first process the effects of assignment "up" the register forest
-        // e.g. the effects on %eax when assigning to %ah
-        {
-            const Register *base  = getRegByNum(myNum);
-            const Register *child = base;
-            int offsetInParent    = 0;
-
-            while (child != nullptr) {
-                const bool hasParent = m_parent.find(child->getName()) != m_parent.end();
-                if (!hasParent) {
-                    break; // reached top of tree
-                }
-                const Register *parent = getRegByName(m_parent.at(child->getName()));
-                assert(parent != nullptr);
-
-                offsetInParent += m_offsetInParent.at(child->getName());
-                const RegNum parentID = getRegNumByName(parent->getName());
-
-                // is the parent actually used? if not, then skip
-                if (usedRegs.find(parentID) != usedRegs.end()) {
-                    std::shared_ptr<Assignment> overlapAsgn(
-                        emitOverlappedStmt(stmt, parent, base, offsetInParent));
-                    if (overlapAsgn) {
-                        result->append(overlapAsgn);
-                    }
-                }
-                child = parent; // up one level
-            }
+    // First the effects of the assignment "up" the register forest
+    // (e.g. the effects on %eax when assigning to %ah), then "down" the register tree
+    // (e.g. the effects on %ah when assigning to %eax).
+    for (const Overlap &overlap : m_overlaps[myNum]) {
+        // is the overlapping register actually used? if not, then skip
+        if (!usedRegs.contains(overlap.regNum)) {
+            continue;
         }
 
-        // now process the effects of assignment "down" the register tree
-        // e.g. the effects on %ah when assigning to %eax
-        {
-            const Register *base = getRegByNum(myNum);
-            std::stack<std::pair<const Register *, int>> toVisit({ { base, 0 } });
-
-            while (!toVisit.empty()) {
-                const auto &[current, offset] = toVisit.top();
-                toVisit.pop();
-
-                if (current != base) {
-                    const RegNum currentID = getRegNumByName(current->getName());
-
-                    if (m_offsetInParent.find(current->getName()) != m_offsetInParent.end()) {
-                        // is the parent actually used? if not, then skip
-                        if (usedRegs.find(currentID) != usedRegs.end()) {
-                            std::shared_ptr<Assignment> overlapAsgn(
-                                emitOverlappedStmt(stmt, current, base, offset));
-                            if (overlapAsgn) {
-                                result->append(overlapAsgn);
-                            }
-                        }
-                    }
-                }
+        std::shared_ptr<Assignment> overlapAsgn = emitOverlappedStmt(stmt, overlap.regNum, myNum,
+                                                                     overlap.offset);
+        if (overlapAsgn) {
+            result->append(overlapAsgn);
+        }
+    }
+
+    return result;
+}
+
+
+void RegDB::updateOverlaps()
+{
+    for (RegNum base = 0; base < m_regInfo.size(); base++) {
+        std::vector<Overlap> &overlaps = m_overlaps[base];
+        overlaps.clear();
+
+        if (!isRegNumDefined(base)) {
+            continue;
+        }
+
+        // parents, bottom-up
+        int offsetInParent = 0;
+        for (RegNum child = base; m_parent[child] != RegNumSpecial; child = m_parent[child]) {
+            offsetInParent += m_offsetInParent[child];
+            overlaps.push_back({ m_parent[child], offsetInParent });
+        }
 
-                if (m_children.find(current->getName()) != m_children.end()) {
-                    // recurse to children if there are any
-                    for (const auto &[childOffset, child] : m_children.at(current->getName())) {
-                        toVisit.push({ getRegByName(child), offset + childOffset });
-                    }
+        // children, depth-first
+        std::stack<Overlap> toVisit({ { base, 0 } });
+
+        while (!toVisit.empty()) {
+            const Overlap current = toVisit.top();
+            toVisit.pop();
+
+            if (current.regNum != base) {
+                overlaps.push_back(current);
+            }
+
+            for (const auto &[childOffset, child] : m_children[current.regNum]) {
+                if (child != RegNumSpecial) {
+                    toVisit.push({ child, current.offset + childOffset });
                 }
             }
         }
     }
-    catch (std::out_of_range &) {
-        assert(false);
+}
+
+
+const Register *RegDB::findReg(RegNum regNum) const
+{
+    if (regNum >= m_regInfo.size() || m_regInfo[regNum].getRegType() == RegType::Invalid) {
+        return nullptr;
     }
 
-    return result;
+    return &m_regInfo[regNum];
 }
 
 
 std::shared_ptr<Assignment> RegDB::emitOverlappedStmt(const std::shared_ptr<Assignment> &original,
-                                                      const Register *lhs, const Register *rhs,
+                                                      RegNum lhsID, RegNum rhsID,
                                                       int offsetInParent) const
 {
-    const RegNum lhsID = getRegNumByName(lhs->getName());
-    const RegNum rhsID = getRegNumByName(rhs->getName());
+    const Register *lhs = findReg(lhsID);
+    const Register *rhs = findReg(rhsID);
 
-    if (lhsID == RegNumSpecial || rhsID == RegNumSpecial) {
+    if (!lhs || !rhs) {
         return nullptr;
     }
 
@@ -15,6 +15,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 
 class Assignment;
@@ -22,6 +23,11 @@ class Assignment;
 
 /**
  * Manages and provides access to register information of a single architecture.
+ *
+ * Normal registers and their relations are stored in arrays indexed by RegNum.
+ * For each register, the list of overlapping registers (e.g. %ax, %ah and %al for %eax)
+ * is computed when the relations are created, so processing overlapped registers
+ * does not require any name lookups.
  */
 class BOOMERANG_API RegDB
 {
@@ -98,9 +104,22 @@ public:
     ///   procedure (This is indicated by \p usedRegs not containing %al).
     /// \returns all additional statements
     std::unique_ptr<RTL> processOverlappedRegs(const std::shared_ptr<Assignment> &stmt,
-                                               const std::set<RegNum> &usedRegs) const;
+                                               const RegNumSet &usedRegs) const;
 
 private:
+    /// A register that overlaps another register.
+    struct Overlap
+    {
+        RegNum regNum; ///< the overlapping register
+        int offset;    ///< offset in bits of the smaller register in the larger register
+    };
+
+    /// Recomputes \ref m_overlaps from the register relations.
+    void updateOverlaps();
+
+    /// \returns the normal register with number \p regNum, or nullptr if it does not exist.
+    const Register *findReg(RegNum regNum) const;
+
     /// Emit a new statement assigning the content of \p rhs into \p lhs.
     /// There are 2 cases:
     ///  1. The LHS is larger. In this case, assign only the bits of \p lhs
@@ -111,12 +130,12 @@ private:
     ///     that also belong to \p lhs. (e.g. %ah := %eax@[8..15])
     ///
     /// \param original The orignal assignment
-    /// \param lhs The register that is assigned to
-    /// \param rhs The register that is assigned from
+    /// \param lhsNum The register that is assigned to
+    /// \param rhsNum The register that is assigned from
     /// \param offsetInParent The offset in bits of the child register (for %eax -> %ah this is 8)
     /// \returns the new register content mapping assignment.
     std::shared_ptr<Assignment> emitOverlappedStmt(const std::shared_ptr<Assignment> &original,
-                                                   const Register *lhs, const Register *rhs,
+                                                   RegNum lhsNum, RegNum rhsNum,
                                                    int offsetInParent) const;
 
 private:
@@ -127,15 +146,23 @@ private:
     std::map<QString, RegID> m_regNums;
 
     /// Stores info about a register such as its size, its addresss etc
-    /// (see register.h).
-    std::map<RegID, Register> m_regInfo;
+    /// (see register.h), indexed by RegNum.
+    /// Entries of undefined registers have RegType::Invalid.
+    std::vector<Register> m_regInfo;
 
     /// A map from symbolic representation of a special (non-addressable) register
     /// to a Register object
     std::map<QString, Register> m_specialRegInfo;
 
-    /// Register coverage information
-    std::map<QString, QString> m_parent;                  ///< child -> parent
-    std::map<QString, int> m_offsetInParent;              ///< child -> offset (if parent exists)
-    std::map<QString, std::map<int, QString>> m_children; ///< parent -> (offset -> child)
+    /// Register coverage information, indexed by RegNum of the child or parent
+    std::vector<RegNum> m_parent;                  ///< child -> parent (or RegNumSpecial)
+    std::vector<int> m_offsetInParent;             ///< child -> offset (if parent exists)
+    std::vector<std::map<int, RegNum>> m_children; ///< parent -> (offset -> child)
+
+    /// Special registers that are children of a normal register
+    std::set<QString> m_specialChildren;
+
+    /// For each register, all registers that overlap it, in the order the overlap
+    /// statements are emitted (first all parents bottom-up, then all children).
+    std::vector<std::vector<Overlap>> m_overlaps;
 };
@@ -15,9 +15,11 @@
 
 #include <QString>
 
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 
 class Type;
@@ -81,6 +83,41 @@ static constexpr const RegNum RegNumSpecial = 0xFFFF;
 static constexpr const RegID RegIDSpecial   = RegID(RegType::Invalid, RegNumSpecial, 0);
 
 
+/**
+ * A set of (non-special) register numbers, stored as a bit set indexed by RegNum.
+ */
+class RegNumSet
+{
+public:
+    RegNumSet() = default;
+    RegNumSet(std::initializer_list<RegNum> regNums)
+    {
+        for (RegNum regNum : regNums) {
+            insert(regNum);
+        }
+    }
+
+public:
+    /// Add \p regNum to the set. Special registers are ignored.
+    void insert(RegNum regNum)
+    {
+        if (regNum == RegNumSpecial) {
+            return;
+        }
+        else if (regNum >= m_bits.size()) {
+            m_bits.resize(regNum + 1, false);
+        }
+
+        m_bits[regNum] = true;
+    }
+
+    bool contains(RegNum regNum) const { return regNum < m_bits.size() && m_bits[regNum]; }
+
+private:
+    std::vector<bool> m_bits;
+};
+
+
 /**
  * Summarises one line of the \@REGISTERS section of an SSL
  * file. This class is used extensively in sslparser.y.
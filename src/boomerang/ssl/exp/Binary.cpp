@@ -19,6 +19,7 @@
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/SizeType.h"
 #include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -51,7 +52,7 @@ Binary::~Binary()
 
 std::shared_ptr<Binary> Binary::get(OPER op, SharedExp e1, SharedExp e2)
 {
-    return std::make_shared<Binary>(op, e1, e2);
+    return IRArena::makeShared<Binary>(op, e1, e2);
 }
 
 
@@ -86,7 +87,7 @@ void Binary::commute()
 SharedExp Binary::clone() const
 {
     assert(m_subExp1 && m_subExp2);
-    return std::make_shared<Binary>(m_oper, m_subExp1->clone(), m_subExp2->clone());
+    return IRArena::makeShared<Binary>(m_oper, m_subExp1->clone(), m_subExp2->clone());
 }
 
 
@@ -12,6 +12,7 @@
 
 #include "boomerang/ssl/exp/Exp.h"
 #include "boomerang/util/Address.h"
+#include "boomerang/util/IRArena.h"
 
 #include <variant>
 
@@ -62,13 +63,13 @@ public:
     template<class T>
     static std::shared_ptr<Const> get(T i)
     {
-        return std::make_shared<Const>(i);
+        return IRArena::makeShared<Const>(i);
     }
 
     template<class T>
     static std::shared_ptr<Const> get(T i, SharedType ty)
     {
-        std::shared_ptr<Const> c = std::make_shared<Const>(i);
+        std::shared_ptr<Const> c = IRArena::makeShared<Const>(i);
         c->setType(ty);
         return c;
     }
@@ -11,6 +11,7 @@
 
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/LocationSet.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
@@ -62,13 +63,13 @@ Location::Location(OPER oper, SharedExp exp, UserProc *proc)
 
 SharedExp Location::clone() const
 {
-    return std::make_shared<Location>(m_oper, m_subExp1->clone(), m_proc);
+    return IRArena::makeShared<Location>(m_oper, m_subExp1->clone(), m_proc);
 }
 
 
 SharedExp Location::get(OPER op, SharedExp childExp, UserProc *proc)
 {
-    return std::make_shared<Location>(op, childExp, proc);
+    return IRArena::makeShared<Location>(op, childExp, proc);
 }
 
 
@@ -11,6 +11,7 @@
 
 #include "boomerang/ssl/statements/Statement.h"
 #include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -26,7 +27,7 @@ RefExp::RefExp(SharedExp e, const SharedStmt &d)
 
 std::shared_ptr<RefExp> RefExp::get(SharedExp e, const SharedStmt &def)
 {
-    return std::make_shared<RefExp>(e, def);
+    return IRArena::makeShared<RefExp>(e, def);
 }
 
 
@@ -12,6 +12,7 @@
 #include "boomerang/ssl/type/BooleanType.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -31,13 +32,13 @@ Terminal::Terminal(const Terminal &o)
 
 SharedExp Terminal::get(OPER op)
 {
-    return std::make_shared<Terminal>(op);
+    return IRArena::makeShared<Terminal>(op);
 }
 
 
 SharedExp Terminal::clone() const
 {
-    return std::make_shared<Terminal>(*this);
+    return IRArena::makeShared<Terminal>(*this);
 }
 
 
@@ -16,6 +16,7 @@
 #include "boomerang/ssl/type/FloatType.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -44,7 +45,7 @@ Ternary::~Ternary()
 
 std::shared_ptr<Ternary> Ternary::get(OPER op, SharedExp e1, SharedExp e2, SharedExp e3)
 {
-    return std::make_shared<Ternary>(op, e1, e2, e3);
+    return IRArena::makeShared<Ternary>(op, e1, e2, e3);
 }
 
 
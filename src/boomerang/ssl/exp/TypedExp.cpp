@@ -10,6 +10,7 @@
 #include "TypedExp.h"
 
 #include "boomerang/ssl/type/Type.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -38,19 +39,19 @@ TypedExp::TypedExp(const TypedExp &o)
 
 std::shared_ptr<TypedExp> TypedExp::get(SharedExp exp)
 {
-    return std::make_shared<TypedExp>(exp);
+    return IRArena::makeShared<TypedExp>(exp);
 }
 
 
 std::shared_ptr<TypedExp> TypedExp::get(SharedType ty, SharedExp exp)
 {
-    return std::make_shared<TypedExp>(ty, exp);
+    return IRArena::makeShared<TypedExp>(ty, exp);
 }
 
 
 SharedExp TypedExp::clone() const
 {
-    return std::make_shared<TypedExp>(m_type, m_subExp1->clone());
+    return IRArena::makeShared<TypedExp>(m_type, m_subExp1->clone());
 }
 
 
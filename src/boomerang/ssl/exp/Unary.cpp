@@ -21,6 +21,7 @@
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/VoidType.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -49,7 +50,7 @@ Unary::~Unary()
 
 SharedExp Unary::get(OPER op, SharedExp e1)
 {
-    return std::make_shared<Unary>(op, e1);
+    return IRArena::makeShared<Unary>(op, e1);
 }
 
 
@@ -84,7 +85,7 @@ SharedExp &Unary::refSubExp1()
 SharedExp Unary::clone() const
 {
     assert(m_subExp1);
-    return std::make_shared<Unary>(m_oper, m_subExp1->clone());
+    return IRArena::makeShared<Unary>(m_oper, m_subExp1->clone());
 }
 
 
@@ -17,6 +17,7 @@
 #include "boomerang/ssl/exp/RefExp.h"
 #include "boomerang/ssl/exp/Unary.h"
 #include "boomerang/ssl/type/Type.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/LocationSet.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
@@ -58,7 +59,7 @@ Assign::Assign(const Assign &other)
 
 SharedStmt Assign::clone() const
 {
-    return std::make_shared<Assign>(*this);
+    return IRArena::makeShared<Assign>(*this);
 }
 
 
@@ -15,6 +15,7 @@
 #include "boomerang/ssl/exp/Ternary.h"
 #include "boomerang/ssl/statements/Assign.h"
 #include "boomerang/ssl/statements/StatementHelper.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/LocationSet.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
 #include "boomerang/visitor/stmtexpvisitor/StmtExpVisitor.h"
@@ -120,7 +121,7 @@ void BoolAssign::printCompact(OStream &os) const
 
 SharedStmt BoolAssign::clone() const
 {
-    return std::make_shared<BoolAssign>(*this);
+    return IRArena::makeShared<BoolAssign>(*this);
 }
 
 
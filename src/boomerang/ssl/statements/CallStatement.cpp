@@ -30,6 +30,8 @@
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/VoidType.h"
 #include "boomerang/util/ArgSourceProvider.h"
+#include "boomerang/util/IRArena.h"
+#include "boomerang/util/LocationSet.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ImplicitConverter.h"
 #include "boomerang/visitor/expmodifier/Localiser.h"
@@ -107,7 +109,7 @@ CallStatement &CallStatement::operator=(const CallStatement &other)
 
 SharedStmt CallStatement::clone() const
 {
-    return std::make_shared<CallStatement>(*this);
+    return IRArena::makeShared<CallStatement>(*this);
 }
 
 
@@ -317,11 +319,7 @@ bool CallStatement::searchAndReplace(const Exp &pattern, SharedExp replace, bool
     }
 
     if (cc) {
-        DefCollector::iterator dd;
-
-        for (dd = m_defCol.begin(); dd != m_defCol.end(); ++dd) {
-            change |= (*dd)->searchAndReplace(pattern, replace, cc);
-        }
+        change |= m_defCol.searchAndReplace(pattern, replace, cc);
     }
 
     return change;
@@ -572,12 +570,19 @@ void CallStatement::updateArguments()
     ArgSourceProvider asp(this);
     SharedExp loc;
 
+    // Index of the left hand sides of oldArguments, so that checking for existing arguments
+    // does not need a linear search for every source location
+    LocationSet oldArgLocs;
+    for (const SharedStmt &oldArg : oldArguments) {
+        oldArgLocs.insert(oldArg->as<Assignment>()->getLeft());
+    }
+
     while ((loc = asp.nextArgLoc()) != nullptr) {
         if (!m_proc->canBeParam(loc)) {
             continue;
         }
 
-        if (!oldArguments.existsOnLeft(loc)) {
+        if (!oldArgLocs.contains(loc)) {
             // Check if the location is renamable. If not, localising won't work, since it relies on
             // definitions collected in the call, and you just get m[...]{-} even if there are
             // definitions.
@@ -600,6 +605,7 @@ void CallStatement::updateArguments()
             asgn->setFragment(m_fragment);
 
             oldArguments.append(asgn);
+            oldArgLocs.insert(asgn->getLeft());
         }
     }
 
@@ -11,6 +11,7 @@
 
 #include "boomerang/ssl/exp/Exp.h"
 #include "boomerang/ssl/type/Type.h"
+#include "boomerang/util/IRArena.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -43,7 +44,7 @@ ImplicitAssign::ImplicitAssign(const ImplicitAssign &other)
 
 SharedStmt ImplicitAssign::clone() const
 {
-    return std::make_shared<ImplicitAssign>(*this);
+    return IRArena::makeShared<ImplicitAssign>(*this);
 }
 
 
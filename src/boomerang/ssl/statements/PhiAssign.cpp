@@ -16,6 +16,7 @@
 #include "boomerang/ssl/statements/Assign.h"
 #include "boomerang/ssl/type/Type.h"
 #include "boomerang/util/LocationSet.h"
+#include "boomerang/util/Util.h"
 #include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpModifier.h"
 #include "boomerang/visitor/expvisitor/ExpVisitor.h"
@@ -24,16 +25,20 @@
 #include "boomerang/visitor/stmtmodifier/StmtPartModifier.h"
 #include "boomerang/visitor/stmtvisitor/StmtVisitor.h"
 
+#include <algorithm>
+
 
 SharedStmt PhiAssign::clone() const
 {
     std::shared_ptr<PhiAssign> pa(new PhiAssign(m_type->clone(), m_lhs->clone()));
 
+    pa->m_defs.reserve(m_defs.size());
+
     for (const auto &[frag, ref] : m_defs) {
         assert(ref->getSubExp1());
 
         // Clone the expression pointer, but not the fragment pointer (never moves)
-        pa->m_defs.insert({ frag, RefExp::get(ref->getSubExp1()->clone(), ref->getDef()) });
+        pa->m_defs.push_back({ frag, RefExp::get(ref->getSubExp1()->clone(), ref->getDef()) });
     }
 
     return pa;
@@ -202,10 +207,9 @@ void PhiAssign::putAt(IRFragment *frag, const SharedStmt &def, SharedExp e)
     assert(e); // should be something surely
     assert(*e == *getLeft());
 
-    // Can't use operator[] here since PhiInfo is not default-constructible
-    PhiDefs::iterator it = m_defs.find(frag);
-    if (it == m_defs.end()) {
-        m_defs.insert({ frag, RefExp::get(e, def) });
+    PhiDefs::iterator it = lowerBound(frag);
+    if (it == m_defs.end() || Util::ptrCompare<IRFragment>()(frag, it->first)) {
+        m_defs.insert(it, { frag, RefExp::get(e, def) });
     }
     else {
         it->second->setDef(def);
@@ -216,27 +220,27 @@ void PhiAssign::putAt(IRFragment *frag, const SharedStmt &def, SharedExp e)
 
 SharedConstStmt PhiAssign::getStmtAt(IRFragment *idx) const
 {
-    PhiDefs::const_iterator it = m_defs.find(idx);
+    PhiDefs::const_iterator it = findDef(idx);
     return (it != m_defs.end()) ? it->second->getDef() : nullptr;
 }
 
 
 SharedStmt PhiAssign::getStmtAt(IRFragment *idx)
 {
-    PhiDefs::iterator it = m_defs.find(idx);
+    PhiDefs::iterator it = findDef(idx);
     return (it != m_defs.end()) ? it->second->getDef() : nullptr;
 }
 
 
 void PhiAssign::removeAllReferences(const std::shared_ptr<RefExp> &refExp)
 {
-    for (PhiDefs::iterator pi = m_defs.begin(); pi != m_defs.end();) {
-        std::shared_ptr<RefExp> &p = pi->second;
+    // Compact the operands in place; this keeps them sorted.
+    auto newEnd = std::remove_if(m_defs.begin(), m_defs.end(), [&refExp](const auto &operand) {
+        const std::shared_ptr<RefExp> &p = operand.second;
         assert(p->getSubExp1());
 
-        if (*p == *refExp) {       // Will we ever see this?
-            pi = m_defs.erase(pi); // Erase this phi parameter
-            continue;
+        if (*p == *refExp) { // Will we ever see this?
+            return true;     // Erase this phi parameter
         }
 
         // Chase the definition
@@ -244,12 +248,52 @@ void PhiAssign::removeAllReferences(const std::shared_ptr<RefExp> &refExp)
         if (def && def->isAssign()) {
             SharedExp rhs = def->as<Assign>()->getRight();
 
-            if (*rhs == *refExp) {     // Check if RHS is a single reference to this
-                pi = m_defs.erase(pi); // Yes, erase this phi parameter
-                continue;
-            }
+            // Check if RHS is a single reference to this
+            return *rhs == *refExp;
         }
 
-        ++pi; // keep it
+        return false; // keep it
+    });
+
+    m_defs.erase(newEnd, m_defs.end());
+}
+
+
+PhiAssign::PhiDefs::iterator PhiAssign::lowerBound(IRFragment *frag)
+{
+    return std::lower_bound(m_defs.begin(), m_defs.end(), frag,
+                            [](const PhiDefs::value_type &operand, IRFragment *f) {
+                                return Util::ptrCompare<IRFragment>()(operand.first, f);
+                            });
+}
+
+
+PhiAssign::PhiDefs::const_iterator PhiAssign::lowerBound(IRFragment *frag) const
+{
+    return std::lower_bound(m_defs.begin(), m_defs.end(), frag,
+                            [](const PhiDefs::value_type &operand, IRFragment *f) {
+                                return Util::ptrCompare<IRFragment>()(operand.first, f);
+                            });
+}
+
+
+PhiAssign::PhiDefs::iterator PhiAssign::findDef(IRFragment *frag)
+{
+    PhiDefs::iterator it = lowerBound(frag);
+    if (it != m_defs.end() && !Util::ptrCompare<IRFragment>()(frag, it->first)) {
+        return it;
     }
+
+    return m_defs.end();
+}
+
+
+PhiAssign::PhiDefs::const_iterator PhiAssign::findDef(IRFragment *frag) const
+{
+    PhiDefs::const_iterator it = lowerBound(frag);
+    if (it != m_defs.end() && !Util::ptrCompare<IRFragment>()(frag, it->first)) {
+        return it;
+    }
+
+    return m_defs.end();
 }
@@ -34,7 +34,9 @@
 class BOOMERANG_API PhiAssign : public Assignment
 {
 public:
-    typedef std::map<IRFragment *, std::shared_ptr<RefExp>, Util::ptrCompare<IRFragment>> PhiDefs;
+    /// The operands of the phi, sorted by fragment (see \ref Util::ptrCompare).
+    /// Operands are stored contiguously; lookups are binary searches.
+    typedef std::vector<std::pair<IRFragment *, std::shared_ptr<RefExp>>> PhiDefs;
     typedef MapValueIterator<PhiDefs> iterator;
     typedef MapValueConstIterator<PhiDefs> const_iterator;
     typedef MapValueReverseIterator<PhiDefs> reverse_iterator;
@@ -123,6 +125,15 @@ public:
 
     void removeAllReferences(const std::shared_ptr<RefExp> &ref);
 
+private:
+    /// \returns the first operand whose fragment is not less than \p frag
+    PhiDefs::iterator lowerBound(IRFragment *frag);
+    PhiDefs::const_iterator lowerBound(IRFragment *frag) const;
+
+    /// \returns the operand for fragment \p frag, or end() if there is none
+    PhiDefs::iterator findDef(IRFragment *frag);
+    PhiDefs::const_iterator findDef(IRFragment *frag) const;
+
 private:
     PhiDefs m_defs; ///< A vector of information about definitions
 };
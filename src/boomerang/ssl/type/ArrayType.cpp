@@ -50,6 +50,20 @@ uint64 ArrayType::convertLength(SharedType b) const
 }
 
 
+void ArrayType::setInCompound()
+{
+    if (isInCompound()) {
+        return;
+    }
+
+    Type::setInCompound();
+
+    if (m_baseType) {
+        m_baseType->setInCompound();
+    }
+}
+
+
 void ArrayType::setBaseType(SharedType b)
 {
     // MVE: not sure if this is always the right thing to do
@@ -71,6 +85,19 @@ void ArrayType::setBaseType(SharedType b)
     }
 
     m_baseType = b;
+
+    if (isInCompound()) {
+        m_baseType->setInCompound();
+    }
+
+    sizeChanged();
+}
+
+
+void ArrayType::setLength(unsigned n)
+{
+    m_length = n;
+    sizeChanged();
 }
 
 
@@ -88,7 +115,10 @@ Type::Size ArrayType::getSize() const
 
 bool ArrayType::operator==(const Type &other) const
 {
-    if (!other.isArray()) {
+    if (this == &other) {
+        return true;
+    }
+    else if (!other.isArray()) {
         return false;
     }
 
@@ -50,6 +50,9 @@ public:
     /// \copydoc Type::getSize
     Size getSize() const override;
 
+    /// \copydoc Type::setInCompound
+    void setInCompound() override;
+
     /// \copydoc Type::getCtype
     QString getCtype(bool final = false) const override;
 
@@ -69,7 +72,7 @@ public:
 
     /// \returns the number of elements in this array.
     uint64 getLength() const { return m_length; }
-    void setLength(unsigned n) { m_length = n; }
+    void setLength(unsigned n);
 
     /// \returns true iff we do not know the length of the array (yet)
     bool isUnbounded() const;
@@ -23,9 +23,16 @@ BooleanType::~BooleanType()
 }
 
 
+std::shared_ptr<BooleanType> BooleanType::get()
+{
+    static const std::shared_ptr<BooleanType> instance = std::make_shared<BooleanType>();
+    return instance;
+}
+
+
 SharedType BooleanType::clone() const
 {
-    return std::make_shared<BooleanType>();
+    return BooleanType::get();
 }
 
 
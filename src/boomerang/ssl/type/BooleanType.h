@@ -26,7 +26,8 @@ public:
     BooleanType &operator=(BooleanType &&other) = default;
 
 public:
-    static std::shared_ptr<BooleanType> get() { return std::make_shared<BooleanType>(); }
+    /// \returns the shared bool type (see \ref VoidType::get).
+    static std::shared_ptr<BooleanType> get();
 
     /// \copydoc Type::operator==
     bool operator==(const Type &other) const override;
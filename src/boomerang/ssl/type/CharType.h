@@ -27,7 +27,8 @@ public:
     CharType &operator=(CharType &&other) = default;
 
 public:
-    static std::shared_ptr<CharType> get() { return std::make_shared<CharType>(); }
+    /// \returns the shared char type (see \ref VoidType::get).
+    static std::shared_ptr<CharType> get();
 
     /// \copydoc Type::operator==
     bool operator==(const Type &other) const override;
@@ -12,6 +12,8 @@
 #include "boomerang/ssl/type/SizeType.h"
 #include "boomerang/util/Util.h"
 
+#include <algorithm>
+
 
 CompoundType::CompoundType()
     : Type(TypeClass::Compound)
@@ -44,14 +46,9 @@ bool CompoundType::isCompatibleWith(const Type &other, bool all) const
 
 Type::Size CompoundType::getSize() const
 {
-    Size size = 0;
-
-    for (const SharedType &elem : m_types) {
-        // NOTE: this assumes no padding... perhaps explicit padding will be needed
-        size += elem->getSize();
-    }
-
-    return size;
+    // NOTE: this assumes no padding... perhaps explicit padding will be needed
+    updateOffsets();
+    return m_offsets.back();
 }
 
 
@@ -88,146 +85,158 @@ bool CompoundType::isSubStructOf(const SharedConstType &other) const
 
 SharedType CompoundType::getMemberTypeByName(const QString &name)
 {
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (m_names[i] == name) {
-            return m_types[i];
-        }
-    }
-
-    return nullptr;
+    const int idx = findMemberIdxByName(name);
+    return idx != -1 ? m_types[idx] : nullptr;
 }
 
 
 SharedType CompoundType::getMemberTypeByOffset(uint64 bitOffset)
 {
-    uint64 offset = 0;
+    const int idx = findMemberIdxByOffset(bitOffset);
+    return idx != -1 ? m_types[idx] : nullptr;
+}
 
-    for (auto &elem : m_types) {
-        if (Util::inRange(bitOffset, offset, offset + elem->getSize())) {
-            return elem;
-        }
 
-        offset += elem->getSize();
+void CompoundType::setMemberTypeByOffset(uint64 bitOffset, SharedType ty)
+{
+    const int i = findMemberIdxByOffset(bitOffset);
+    if (i == -1) {
+        return;
+    }
+
+    const Size oldSize = m_types[i]->getSize();
+    m_types[i]         = ty;
+    ty->setInCompound();
+
+    if (ty->getSize() < oldSize) {
+        m_types.insert(m_types.begin() + i + 1, SizeType::get(oldSize - ty->getSize()));
+        m_names.insert(m_names.begin() + i + 1, "pad");
+        m_types[i + 1]->setInCompound();
     }
 
-    return nullptr;
+    membersChanged();
 }
 
 
-void CompoundType::setMemberTypeByOffset(uint64 bitOffset, SharedType ty)
+void CompoundType::setMemberNameByOffset(uint64 bitOffset, const QString &name)
 {
-    uint64 offset = 0;
+    const int idx = findMemberIdxByOffset(bitOffset);
+    if (idx != -1) {
+        m_names[idx]   = name;
+        m_nameIdxValid = false;
+    }
+}
 
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (Util::inRange(bitOffset, offset, offset + m_types[i]->getSize())) {
-            unsigned oldsz = m_types[i]->getSize();
-            m_types[i]     = ty;
 
-            if (ty->getSize() < oldsz) {
-                m_types.push_back(m_types[m_types.size() - 1]);
-                m_names.push_back(m_names[m_names.size() - 1]);
+QString CompoundType::getMemberNameByOffset(uint64 n)
+{
+    const int idx = findMemberIdxByOffset(n);
+    return idx != -1 ? m_names[idx] : "";
+}
 
-                for (int _n = getNumMembers() - 1; _n > i; _n--) {
-                    m_types[_n] = m_types[_n - 1];
-                    m_names[_n] = m_names[_n - 1];
-                }
 
-                m_types[i + 1] = SizeType::get(oldsz - ty->getSize());
-                m_names[i + 1] = "pad";
-            }
+uint64 CompoundType::getMemberOffsetByIdx(int n)
+{
+    assert(n < getNumMembers());
 
-            return;
-        }
+    updateOffsets();
+    return m_offsets[n];
+}
 
-        offset += m_types[i]->getSize();
+
+uint64 CompoundType::getMemberOffsetByName(const QString &member)
+{
+    const int idx = findMemberIdxByName(member);
+    if (idx == -1) {
+        return static_cast<unsigned int>(-1);
     }
+
+    updateOffsets();
+    return m_offsets[idx];
 }
 
 
-void CompoundType::setMemberNameByOffset(uint64 bitOffset, const QString &name)
+uint64 CompoundType::getOffsetRemainder(uint64 bitSize)
 {
-    uint64 offset = 0;
+    updateOffsets();
 
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (Util::inRange(bitOffset, offset, offset + m_types[i]->getSize())) {
-            m_names[i] = name;
-            return;
-        }
-
-        offset += m_types[i]->getSize();
-    }
+    // Find the last member that starts at or before bitSize.
+    // Its start is the sum of the sizes of all members ending at or before bitSize.
+    auto it = std::upper_bound(m_offsets.begin(), m_offsets.end(), bitSize);
+    return bitSize - *(it - 1);
 }
 
 
-QString CompoundType::getMemberNameByOffset(uint64 n)
+void CompoundType::updateOffsets() const
 {
-    uint64 offset = 0;
+    const uint64 version = Type::getLayoutVersion();
+    if (m_offsetsVersion == version && m_offsets.size() == m_types.size() + 1) {
+        return;
+    }
 
-    for (int i = 0; i < getNumMembers(); i++) {
-        // if (offset >= n && n < offset + types[i]->getSize())
-        if ((offset <= n) && (n < offset + m_types[i]->getSize())) {
-            // return getName(offset == n ? i : i - 1);
-            return m_names[i];
-        }
+    m_offsets.resize(m_types.size() + 1);
 
+    uint64 offset = 0;
+    for (std::size_t i = 0; i < m_types.size(); ++i) {
+        m_offsets[i] = offset;
         offset += m_types[i]->getSize();
     }
 
-    return "";
+    m_offsets.back() = offset;
+    m_offsetsVersion = version;
 }
 
 
-uint64 CompoundType::getMemberOffsetByIdx(int n)
+int CompoundType::findMemberIdxByOffset(uint64 bitOffset) const
 {
-    assert(n < getNumMembers());
+    updateOffsets();
 
-    uint64 offset = 0;
-    for (int i = 0; i < n; i++) {
-        offset += m_types[i]->getSize();
+    // last member starting at or before bitOffset; for empty members at the same offset,
+    // this is the (non-empty) member following them.
+    auto it = std::upper_bound(m_offsets.begin(), m_offsets.end(), bitOffset);
+    if (it == m_offsets.begin() || it == m_offsets.end()) {
+        return -1; // past the end of the struct
     }
 
-    return offset;
+    const int idx = static_cast<int>(std::distance(m_offsets.begin(), it)) - 1;
+    return Util::inRange(bitOffset, m_offsets[idx], m_offsets[idx + 1]) ? idx : -1;
 }
 
 
-uint64 CompoundType::getMemberOffsetByName(const QString &member)
+int CompoundType::findMemberIdxByName(const QString &name) const
 {
-    uint64 offset = 0;
+    if (!m_nameIdxValid) {
+        m_nameIdx.clear();
+        m_nameIdx.reserve(static_cast<int>(m_names.size()));
 
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (m_names[i] == member) {
-            return offset;
+        // iterate backwards so that the first member with a given name wins
+        for (int i = static_cast<int>(m_names.size()) - 1; i >= 0; --i) {
+            m_nameIdx.insert(m_names[i], i);
         }
 
-        offset += m_types[i]->getSize();
+        m_nameIdxValid = true;
     }
 
-    return static_cast<unsigned int>(-1);
+    return m_nameIdx.value(name, -1);
 }
 
 
-uint64 CompoundType::getOffsetRemainder(uint64 bitSize)
+void CompoundType::membersChanged()
 {
-    uint64 remainder = bitSize;
-    uint64 offset    = 0;
+    m_offsetsVersion = 0;
+    m_nameIdxValid   = false;
 
-    for (auto &elem : m_types) {
-        offset += elem->getSize();
-
-        if (offset > bitSize) {
-            break;
-        }
-
-        remainder -= elem->getSize();
-    }
-
-    return remainder;
+    // this might be a member of another struct that has changed size now
+    sizeChanged();
 }
 
 
 bool CompoundType::operator==(const Type &other) const
 {
-    if (getId() != other.getId()) {
+    if (this == &other) {
+        return true;
+    }
+    else if (getId() != other.getId()) {
         return false;
     }
     else if (getSize() != other.getSize()) {
@@ -303,8 +312,10 @@ void CompoundType::addMember(SharedType memberType, const QString &memberName)
         memberType = existingType;
     }
 
+    memberType->setInCompound();
     m_types.push_back(memberType);
     m_names.push_back(memberName);
+    membersChanged();
 }
 
 
@@ -12,6 +12,8 @@
 
 #include "boomerang/ssl/type/Type.h"
 
+#include <QHash>
+
 #include <vector>
 
 
@@ -92,7 +94,30 @@ protected:
     /// \copydoc Type::isCompatible
     bool isCompatible(const Type &other, bool all) const override;
 
+private:
+    /// Recompute the member offsets if they are out of date.
+    void updateOffsets() const;
+
+    /// \returns the index of the member containing the bit at \p bitOffset,
+    /// or -1 if there is no such member.
+    int findMemberIdxByOffset(uint64 bitOffset) const;
+
+    /// \returns the index of the first member named \p name, or -1 if there is no such member.
+    int findMemberIdxByName(const QString &name) const;
+
+    /// Must be called whenever the member list is changed.
+    void membersChanged();
+
 private:
     std::vector<SharedType> m_types;
     std::vector<QString> m_names;
+
+    /// Cumulative bit offsets of the members. Entry i is the offset of member i,
+    /// the last entry is the size of the whole structure.
+    /// Since the sizes of the member types can change, this is only valid
+    /// as long as \ref Type::getLayoutVersion does not change.
+    mutable std::vector<uint64> m_offsets;
+    mutable uint64 m_offsetsVersion = 0;   ///< Layout version of m_offsets; 0 if invalid
+    mutable QHash<QString, int> m_nameIdx; ///< Maps member names to the first member index
+    mutable bool m_nameIdxValid = false;
 };
@@ -39,6 +39,13 @@ Type::Size IntegerType::getSize() const
 }
 
 
+void IntegerType::setSize(Size sz)
+{
+    m_size = sz;
+    sizeChanged();
+}
+
+
 void IntegerType::hintAsSigned()
 {
     m_sign = std::min((Sign)((int)m_sign + 1), Sign::SignedStrong);
@@ -135,7 +142,17 @@ SharedType IntegerType::meetWith(SharedType other, bool &changed, bool useHighes
 
     if (other->resolvesToInteger()) {
         std::shared_ptr<IntegerType> otherInt = other->as<IntegerType>();
-        std::shared_ptr<IntegerType> result   = this->clone()->as<IntegerType>();
+
+        // Avoid creating a new type if neither the size nor the signedness change
+        const bool signUnchanged = otherInt->isSignUnknown() ||
+                                   (otherInt->isSigned() && m_sign == Sign::SignedStrong) ||
+                                   (otherInt->isUnsigned() && m_sign == Sign::UnsignedStrong);
+
+        if (signUnchanged && otherInt->m_size <= m_size) {
+            return const_cast<IntegerType *>(this)->shared_from_this();
+        }
+
+        std::shared_ptr<IntegerType> result = this->clone()->as<IntegerType>();
 
         // Signedness
         if (otherInt->isSigned()) {
@@ -157,8 +174,13 @@ SharedType IntegerType::meetWith(SharedType other, bool &changed, bool useHighes
         return result;
     }
     else if (other->resolvesToSize()) {
+        std::shared_ptr<SizeType> other_sz = other->as<SizeType>();
+
+        if (m_size == other_sz->getSize()) {
+            return const_cast<IntegerType *>(this)->shared_from_this();
+        }
+
         std::shared_ptr<IntegerType> result = std::dynamic_pointer_cast<IntegerType>(this->clone());
-        std::shared_ptr<SizeType> other_sz  = other->as<SizeType>();
 
         if (m_size == 0) { // Doubt this will ever happen
             result->m_size = other_sz->getSize();
@@ -166,14 +188,15 @@ SharedType IntegerType::meetWith(SharedType other, bool &changed, bool useHighes
             return result;
         }
 
-        if (m_size == other_sz->getSize()) {
-            return result;
-        }
-
         LOG_VERBOSE("Integer size %1 meet with SizeType size %2!", m_size, other_sz->getSize());
 
-        result->m_size = std::max(m_size, other_sz->getSize());
-        changed        = result->m_size != m_size;
+        if (m_size > other_sz->getSize()) {
+            changed = false;
+            return const_cast<IntegerType *>(this)->shared_from_this();
+        }
+
+        result->m_size = other_sz->getSize();
+        changed        = true;
         return result;
     }
 
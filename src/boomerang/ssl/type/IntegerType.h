@@ -48,7 +48,7 @@ public:
     Size getSize() const override;
 
     /// \copydoc Type::setSize
-    void setSize(Size sz) override { m_size = sz; }
+    void setSize(Size sz) override;
 
     /// \copydoc Type::meetWith
     SharedType meetWith(SharedType other, bool &changed, bool useHighestPtr) const override;
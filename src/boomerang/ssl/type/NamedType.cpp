@@ -65,6 +65,18 @@ bool NamedType::operator<(const Type &other) const
 }
 
 
+void NamedType::setInCompound()
+{
+    Type::setInCompound();
+
+    // the size of this type is the size of the type it resolves to
+    SharedType ty = resolvesTo();
+    if (ty && !ty->isInCompound()) {
+        ty->setInCompound();
+    }
+}
+
+
 SharedType NamedType::resolvesTo() const
 {
     SharedType ty = getNamedType(m_name);
@@ -41,6 +41,9 @@ public:
     /// \copydoc Type::getSize
     Size getSize() const override;
 
+    /// \copydoc Type::setInCompound
+    void setInCompound() override;
+
     /// \copydoc Type::getCtype
     QString getCtype(bool final = false) const override;
 
@@ -67,7 +67,10 @@ void PointerType::setSize(Type::Size sz)
 
 bool PointerType::operator==(const Type &other) const
 {
-    if (!other.isPointer()) {
+    if (this == &other) {
+        return true;
+    }
+    else if (!other.isPointer()) {
         return false;
     }
 
@@ -75,6 +75,7 @@ std::shared_ptr<SizeType> SizeType::get()
 void SizeType::setSize(Size sz)
 {
     m_size = sz;
+    sizeChanged();
 }
 
 
@@ -107,15 +108,21 @@ SharedType SizeType::meetWith(SharedType other, bool &changed, bool useHighestPt
     }
 
     if (other->resolvesToSize()) {
-        SharedType result = this->clone();
+        const Size otherSize = other->as<SizeType>()->getSize();
+
+        if (otherSize <= m_size) {
+            if (otherSize != m_size) {
+                LOG_VERBOSE("Size %1 meet with size %2!", m_size, otherSize);
+            }
 
-        if (other->as<SizeType>()->m_size != m_size) {
-            LOG_VERBOSE("Size %1 meet with size %2!", m_size, other->as<SizeType>()->m_size);
+            return const_cast<SizeType *>(this)->shared_from_this();
         }
 
-        const Size newSize = std::max(result->getSize(), other->as<SizeType>()->getSize());
-        changed |= (newSize != result->getSize());
-        result->setSize(newSize);
+        LOG_VERBOSE("Size %1 meet with size %2!", m_size, otherSize);
+
+        SharedType result = this->clone();
+        result->setSize(otherSize);
+        changed = true;
         return result;
     }
 
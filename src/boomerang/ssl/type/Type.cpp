@@ -35,6 +35,7 @@
 
 #include <QMap>
 
+#include <atomic>
 #include <cassert>
 #include <cstring>
 
@@ -42,6 +43,9 @@
 /// For NamedType
 static QMap<QString, SharedType> g_namedTypes;
 
+/// See Type::getLayoutVersion
+static std::atomic<uint64> g_layoutVersion{ 1 };
+
 
 Type::Type(TypeClass _class)
     : m_id(_class)
@@ -60,6 +64,33 @@ void Type::setSize(Type::Size)
 }
 
 
+uint64 Type::getLayoutVersion()
+{
+    return g_layoutVersion.load(std::memory_order_relaxed);
+}
+
+
+void Type::setInCompound()
+{
+    m_inCompound = true;
+}
+
+
+void Type::sizeChanged()
+{
+    // Types that are not part of any compound type (e.g. fresh clones) do not affect any layout
+    if (m_inCompound) {
+        invalidateLayouts();
+    }
+}
+
+
+void Type::invalidateLayouts()
+{
+    g_layoutVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+
 bool Type::isCString() const
 {
     return (resolvesToPointer() && this->as<PointerType>()->getPointsTo()->resolvesToChar()) ||
@@ -75,6 +106,9 @@ bool Type::operator!=(const Type &other) const
 
 void Type::addNamedType(const QString &name, SharedType type)
 {
+    // named types may resolve to a type of a different size now
+    invalidateLayouts();
+
     if (g_namedTypes.find(name) != g_namedTypes.end()) {
         if (!(*type == *g_namedTypes[name])) {
             LOG_WARN("Redefinition of type %1", name);
@@ -110,6 +144,7 @@ SharedType Type::getNamedType(const QString &name)
 void Type::clearNamedTypes()
 {
     g_namedTypes.clear();
+    invalidateLayouts();
 }
 
 
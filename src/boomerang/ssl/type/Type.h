@@ -161,6 +161,19 @@ public:
     /// Changes the bit size of this type.
     virtual void setSize(Size newSize);
 
+    /// \returns a counter that changes whenever the size of a type that is part of a compound type
+    /// might have changed, e.g. by setSize(). Used to invalidate cached type layouts
+    /// (see CompoundType).
+    static uint64 getLayoutVersion();
+
+    /// Mark this type as part of the layout of a compound type, e.g. as a member
+    /// or as the base type of an array member. Only size changes of such types
+    /// change the layout version.
+    virtual void setInCompound();
+
+    /// \returns true if the size of this type affects the layout of a compound type.
+    bool isInCompound() const { return m_inCompound; }
+
 public:
     /// Resolve the original type across named types.
     /// If the type is not named, return this.
@@ -182,6 +195,13 @@ public:
     /// \returns a new Bool/Char/Int
     static SharedType newIntegerLikeType(Size sizeInBits, Sign signedness);
 
+protected:
+    /// Must be called by all functions that change the size of this type.
+    void sizeChanged();
+
+    /// Invalidate all cached type layouts.
+    static void invalidateLayouts();
+
 public:
     QString toString() const;
 
@@ -208,6 +228,9 @@ protected:
 
 protected:
     TypeClass m_id;
+
+private:
+    bool m_inCompound = false; ///< see setInCompound
 };
 
 
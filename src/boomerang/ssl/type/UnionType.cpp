@@ -9,12 +9,16 @@
 #pragma endregion License
 #include "UnionType.h"
 
+#include "boomerang/ssl/type/CompoundType.h"
+#include "boomerang/ssl/type/NamedType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/VoidType.h"
 #include "boomerang/util/log/Log.h"
 
 #include <QHash>
 
+#include <algorithm>
+
 
 bool lessType::operator()(const SharedConstType &lhs, const SharedConstType &rhs) const
 {
@@ -70,11 +74,11 @@ std::shared_ptr<UnionType> UnionType::get(const std::initializer_list<Member> me
 
 SharedType UnionType::clone() const
 {
+    // The members are already sorted and unique, so there is no need to add them one by one.
     std::shared_ptr<UnionType> u = std::make_shared<UnionType>();
-
-    for (auto &[ty, name] : m_entries) {
-        u->addType(ty, name);
-    }
+    u->m_entries                 = m_entries;
+    u->m_typeHashes              = m_typeHashes;
+    u->m_typeIndex               = m_typeIndex;
 
     return u;
 }
@@ -101,7 +105,10 @@ size_t UnionType::getNumTypes() const
 
 bool UnionType::operator==(const Type &other) const
 {
-    if (!other.isUnion()) {
+    if (this == &other) {
+        return true;
+    }
+    else if (!other.isUnion()) {
         return false;
     }
 
@@ -111,9 +118,8 @@ bool UnionType::operator==(const Type &other) const
         return false;
     }
 
-    for (const auto &[ty, name] : m_entries) {
-        Q_UNUSED(name);
-        if (uother.m_entries.find(ty) == uother.m_entries.end()) {
+    for (std::size_t i = 0; i < m_entries.size(); ++i) {
+        if (!uother.hasEntry(m_entries[i].first, m_typeHashes[i])) {
             return false;
         }
     }
@@ -147,7 +153,22 @@ bool UnionType::operator<(const Type &other) const
 
 bool UnionType::hasType(SharedType ty)
 {
-    return m_entries.find(ty) != m_entries.end();
+    return hasEntry(ty, hashType(*ty));
+}
+
+
+void UnionType::setInCompound()
+{
+    if (isInCompound()) {
+        return;
+    }
+
+    // the size of a union is the size of its largest member
+    Type::setInCompound();
+
+    for (const Member &member : m_entries) {
+        member.first->setInCompound();
+    }
 }
 
 
@@ -158,10 +179,16 @@ void UnionType::addType(SharedType newType, const QString &name)
     if (newType->resolvesToVoid()) {
         return;
     }
+
+    sizeChanged();
+
     if (newType->resolvesToUnion()) {
         auto unionTy = newType->as<UnionType>();
         // Note: need to check for name clashes eventually
-        m_entries.insert(unionTy->m_entries.begin(), unionTy->m_entries.end());
+        for (std::size_t i = 0; i < unionTy->m_entries.size(); ++i) {
+            insertEntry(unionTy->m_entries[i].first, unionTy->m_entries[i].second,
+                        unionTy->m_typeHashes[i]);
+        }
     }
     else {
         if (newType->resolvesToSize()) {
@@ -186,12 +213,70 @@ void UnionType::addType(SharedType newType, const QString &name)
             newType = PointerType::get(VoidType::get());
         }
 
-        m_entries.insert({ newType, name });
+        insertEntry(newType, name, hashType(*newType));
         // TODO: update name if not inserted because of type clash
     }
 }
 
 
+void UnionType::insertEntry(const SharedType &type, const QString &name, std::size_t typeHash)
+{
+    if (hasEntry(type, typeHash)) {
+        return;
+    }
+
+    // keep the members sorted so that the order of members does not depend on insertion order
+    auto it = std::upper_bound(m_entries.begin(), m_entries.end(), type,
+                               [](const SharedType &ty, const Member &member) {
+                                   return *ty < *member.first;
+                               });
+
+    m_typeHashes.insert(m_typeHashes.begin() + (it - m_entries.begin()), typeHash);
+    m_entries.insert(it, { type, name });
+    m_typeIndex.insert({ typeHash, type });
+
+    if (isInCompound()) {
+        type->setInCompound();
+    }
+}
+
+
+bool UnionType::hasEntry(const SharedConstType &type, std::size_t typeHash) const
+{
+    const auto [begin, end] = m_typeIndex.equal_range(typeHash);
+
+    for (auto it = begin; it != end; ++it) {
+        if (!(*type < *it->second) && !(*it->second < *type)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+std::size_t UnionType::hashType(const Type &type)
+{
+    // Only use properties that are compared by operator< of the respective type,
+    // so that equivalent types have the same hash.
+    const std::size_t hash = static_cast<std::size_t>(type.getId());
+
+    switch (type.getId()) {
+    case TypeClass::Integer:
+    case TypeClass::Float:
+    case TypeClass::Size: return hash * 31 + type.getSize();
+    case TypeClass::Pointer:
+        return hash * 31 + hashType(*static_cast<const PointerType &>(type).getPointsTo());
+    case TypeClass::Named:
+        return hash * 31 + qHash(static_cast<const NamedType &>(type).getName());
+    case TypeClass::Compound:
+        return hash * 31 + static_cast<const CompoundType &>(type).getNumMembers();
+    case TypeClass::Union: return hash * 31 + static_cast<const UnionType &>(type).getNumTypes();
+    default: return hash;
+    }
+}
+
+
 QString UnionType::getCtype(bool final) const
 {
     QString tmp("union { ");
@@ -12,7 +12,8 @@
 
 #include "boomerang/ssl/type/Type.h"
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 
 struct BOOMERANG_API lessType
@@ -31,8 +32,12 @@ public:
     typedef std::pair<SharedType, QString> Member;
 
 public:
-    /// Maps the type of a union member to its name.
-    typedef std::map<SharedType, QString, lessType> UnionEntries;
+    /// The members of the union (type and name), sorted by type (see \ref lessType).
+    /// Types are unique.
+    /// \note Member types are shared, not copied. Like the sort order, the cached type hashes
+    /// assume that member types are not modified in place (e.g. by setSize()) after they
+    /// have been added to the union.
+    typedef std::vector<Member> UnionEntries;
 
 public:
     /// Create a new empty union type.
@@ -69,6 +74,9 @@ public:
     /// \copydoc Type::getSize
     Size getSize() const override;
 
+    /// \copydoc Type::setInCompound
+    void setInCompound() override;
+
     /// \copydoc Type::getCtype
     QString getCtype(bool final = false) const override;
 
@@ -102,6 +110,26 @@ private:
      */
     void addType(SharedType type, const QString &name = "");
 
+    /// Insert a new member unless a member with an equivalent type already exists.
+    /// \param typeHash structural hash of \p type (see \ref hashType)
+    void insertEntry(const SharedType &type, const QString &name, std::size_t typeHash);
+
+    /// \returns true if a member with a type equivalent to \p type exists.
+    /// \param typeHash structural hash of \p type (see \ref hashType)
+    bool hasEntry(const SharedConstType &type, std::size_t typeHash) const;
+
+    /// \returns a structural hash of \p type. Types that are equivalent
+    /// according to \ref lessType have the same hash.
+    static std::size_t hashType(const Type &type);
+
 private:
     UnionEntries m_entries;
+
+    /// Structural hashes of the member types; m_typeHashes[i] belongs to m_entries[i].
+    std::vector<std::size_t> m_typeHashes;
+
+    /// Maps the structural hash of each member type to the member type.
+    /// Used to check membership without scanning all members;
+    /// types are only compared deeply on a hash collision.
+    std::unordered_multimap<std::size_t, SharedConstType> m_typeIndex;
 };
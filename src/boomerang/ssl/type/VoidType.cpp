@@ -23,6 +23,13 @@ VoidType::~VoidType()
 }
 
 
+std::shared_ptr<VoidType> VoidType::get()
+{
+    static const std::shared_ptr<VoidType> instance = std::make_shared<VoidType>();
+    return instance;
+}
+
+
 SharedType VoidType::clone() const
 {
     return VoidType::get();
@@ -62,7 +69,16 @@ SharedType VoidType::meetWith(SharedType other, bool &changed, bool) const
     else {
         // void meet x = x
         changed |= !other->resolvesToVoid();
-        return other->clone();
+
+        // Stateless types can be shared instead of copied. All other types must be copied,
+        // since the caller may refine the result (e.g. change its size or signedness)
+        // without affecting \p other.
+        switch (other->getId()) {
+        case TypeClass::Void:
+        case TypeClass::Boolean:
+        case TypeClass::Char: return other;
+        default: return other->clone();
+        }
     }
 }
 
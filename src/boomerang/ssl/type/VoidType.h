@@ -27,7 +27,8 @@ public:
     VoidType &operator=(VoidType &&other) = default;
 
 public:
-    static std::shared_ptr<VoidType> get() { return std::make_shared<VoidType>(); }
+    /// \returns the shared void type. Void types do not have any state and are never modified.
+    static std::shared_ptr<VoidType> get();
 
     /// \copydoc Type::operator==
     bool operator==(const Type &other) const override;
@@ -138,45 +138,52 @@ SharedType ArgSourceProvider::curType(SharedExp e)
 
 bool ArgSourceProvider::exists(SharedExp e)
 {
-    bool allZero;
-
     switch (src) {
     case ArgSource::Lib:
-
         if (callSig->hasEllipsis()) {
             // FIXME: for now, just don't check
             return true;
         }
 
-        for (i = 0; i < n; i++) {
-            SharedExp sigParam = callSig->getParamExp(i)->clone();
-            sigParam->removeSubscripts(allZero);
-            call->localiseComp(sigParam);
+        collectSourceLocs();
+        return m_sourceLocs.contains(e);
 
-            if (*sigParam == *e) {
-                return true;
-            }
-        }
+    case ArgSource::Callee: collectSourceLocs(); return m_sourceLocs.contains(e);
 
-        return false;
+    case ArgSource::Collector: return defCol->hasDefOf(e);
 
-    case ArgSource::Callee:
-        for (pp = calleeParams->begin(); pp != calleeParams->end(); ++pp) {
-            SharedExp par = (*pp)->as<Assignment>()->getLeft()->clone();
-            par->removeSubscripts(allZero);
-            call->localiseComp(par);
+    default: assert(false); break;
+    }
 
-            if (*par == *e) {
-                return true;
-            }
-        }
+    return false; // Suppress warning
+}
 
-        return false;
 
-    case ArgSource::Collector: return defCol->hasDefOf(e);
+void ArgSourceProvider::collectSourceLocs()
+{
+    if (m_sourceLocsCollected) {
+        return;
+    }
 
-    default: assert(false); break;
+    m_sourceLocsCollected = true;
+    bool allZero;
+
+    if (src == ArgSource::Lib) {
+        for (int idx = 0; idx < n; idx++) {
+            SharedExp sigParam = callSig->getParamExp(idx)->clone();
+            sigParam->removeSubscripts(allZero);
+            call->localiseComp(sigParam);
+
+            m_sourceLocs.insert(sigParam);
+        }
     }
+    else if (src == ArgSource::Callee) {
+        for (const SharedStmt &param : *calleeParams) {
+            SharedExp par = param->as<Assignment>()->getLeft()->clone();
+            par->removeSubscripts(allZero);
+            call->localiseComp(par);
 
-    return false; // Suppress warning
+            m_sourceLocs.insert(par);
+        }
+    }
 }
@@ -12,6 +12,7 @@
 
 #include "boomerang/db/DefCollector.h"
 #include "boomerang/ssl/exp/ExpHelp.h"
+#include "boomerang/util/LocationSet.h"
 #include "boomerang/util/StatementList.h"
 
 
@@ -69,4 +70,14 @@ public:
     // For ArgSource::Collector
     DefCollector::iterator cc;
     DefCollector *defCol = nullptr;
+
+private:
+    /// Collect the (localised) locations of all parameters of the signature / callee.
+    void collectSourceLocs();
+
+private:
+    /// Cache for \ref exists() for ArgSource::Lib and ArgSource::Callee,
+    /// so the parameters are only localised once.
+    LocationSet m_sourceLocs;
+    bool m_sourceLocsCollected = false;
 };
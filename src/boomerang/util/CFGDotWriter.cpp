@@ -143,7 +143,7 @@ void CFGDotWriter::writeCFG(const ProcCFG *cfg, OStream &of)
         of << "      frag" << frag->getLowAddr() << "[shape=rectangle, label=\"";
 
         IRFragment::RTLIterator rit;
-        StatementList::iterator sit;
+        RTL::iterator sit;
 
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt;
              stmt            = frag->getNextStmt(rit, sit)) {
@@ -0,0 +1,100 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecompilationScope.h"
+
+
+bool DecompilationScope::isUnrestricted() const
+{
+    return !hasRootFilter() && m_maxCalleeDepth == UNLIMITED_DEPTH;
+}
+
+
+bool DecompilationScope::hasRootFilter() const
+{
+    return !m_addressRanges.empty() || !m_namePatterns.empty();
+}
+
+
+void DecompilationScope::addAddressRange(Address from, Address to)
+{
+    if (from < to) {
+        m_addressRanges.emplace_back(from, to);
+    }
+}
+
+
+/// Convert a wildcard pattern to an anchored regular expression pattern.
+static QString wildcardToRegExp(const QString &pattern)
+{
+    QString result = "\\A(?:";
+
+    for (int i = 0; i < pattern.length(); ++i) {
+        const QChar c = pattern[i];
+
+        if (c == '*') {
+            result += ".*";
+        }
+        else if (c == '?') {
+            result += ".";
+        }
+        else if (c == '[') {
+            // copy character sets verbatim, unless they are not terminated.
+            // [!...] is a negated set, which is [^...] in a regular expression.
+            const bool negated = i + 1 < pattern.length() && pattern[i + 1] == '!';
+            const int setBegin = negated ? i + 2 : i + 1;
+
+            // a ']' directly after the opening bracket is part of the set
+            const int end = pattern.indexOf(']', setBegin + 1);
+            if (end == -1) {
+                result += QRegularExpression::escape(c);
+            }
+            else {
+                result += negated ? "[^" : "[";
+                result += pattern.mid(setBegin, end - setBegin + 1);
+                i = end;
+            }
+        }
+        else {
+            result += QRegularExpression::escape(c);
+        }
+    }
+
+    return result + ")\\z";
+}
+
+
+void DecompilationScope::addNamePattern(const QString &pattern)
+{
+    m_namePatterns.emplace_back(wildcardToRegExp(pattern));
+}
+
+
+bool DecompilationScope::isRoot(Address entryAddr, const QString &name) const
+{
+    for (const Interval<Address> &range : m_addressRanges) {
+        if (range.contains(entryAddr)) {
+            return true;
+        }
+    }
+
+    for (const QRegularExpression &pattern : m_namePatterns) {
+        if (!name.isEmpty() && pattern.match(name).hasMatch()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool DecompilationScope::isDepthInScope(int depth) const
+{
+    return m_maxCalleeDepth == UNLIMITED_DEPTH || depth <= m_maxCalleeDepth;
+}
@@ -0,0 +1,71 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+#include "boomerang/util/Address.h"
+#include "boomerang/util/Interval.h"
+
+#include <QRegularExpression>
+#include <QString>
+
+#include <vector>
+
+
+/**
+ * Restricts decoding and decompilation to a part of the program.
+ *
+ * Procedures whose entry address lies in one of the address ranges, or whose name matches
+ * one of the name patterns, are the roots of the scope. If neither ranges nor patterns
+ * are given, the entry points of the program are the roots.
+ * Callees of a root are in scope up to a maximum call depth below the root.
+ *
+ * Procedures outside of the scope are neither decoded nor decompiled.
+ * Calls to them are treated like calls to procedures that were not decompiled
+ * (as with -nc), i.e. they use the default signature of the callee.
+ */
+class BOOMERANG_API DecompilationScope
+{
+public:
+    static constexpr int UNLIMITED_DEPTH = -1;
+
+public:
+    /// \returns true if the whole program is in scope.
+    bool isUnrestricted() const;
+
+    /// \returns true if the roots are selected by address ranges or name patterns.
+    bool hasRootFilter() const;
+
+    /// Adds all procedures with an entry address in [\p from, \p to) to the roots.
+    void addAddressRange(Address from, Address to);
+
+    /// Adds all procedures whose name matches the wildcard pattern \p pattern
+    /// (e.g. "crypt_*") to the roots. '*' matches any sequence of characters,
+    /// '?' matches any single character and [...] matches a set of characters.
+    void addNamePattern(const QString &pattern);
+
+    /// Only decompile callees at most \p depth calls below a root.
+    /// A depth of 0 only decompiles the roots.
+    void setMaxCalleeDepth(int depth) { m_maxCalleeDepth = depth; }
+    int getMaxCalleeDepth() const { return m_maxCalleeDepth; }
+
+    /// \returns true if the procedure at \p entryAddr named \p name is selected
+    /// by the address ranges or name patterns.
+    bool isRoot(Address entryAddr, const QString &name) const;
+
+    /// \returns true if a callee \p depth calls below a root is in scope.
+    bool isDepthInScope(int depth) const;
+
+private:
+    std::vector<Interval<Address>> m_addressRanges;
+    std::vector<QRegularExpression> m_namePatterns;
+    int m_maxCalleeDepth = UNLIMITED_DEPTH;
+};
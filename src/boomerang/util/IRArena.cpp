@@ -0,0 +1,142 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "IRArena.h"
+
+#include <cassert>
+#include <new>
+
+
+static thread_local IRArena *g_currentArena = nullptr;
+
+
+IRArena::Scope::Scope(IRArena *arena)
+    : m_prev(g_currentArena)
+{
+    g_currentArena = arena;
+}
+
+
+IRArena::Scope::~Scope()
+{
+    g_currentArena = m_prev;
+}
+
+
+IRArena::IRArena()
+{
+    m_freeLists.fill(nullptr);
+}
+
+
+IRArena::~IRArena()
+{
+    assert(m_numLive == 0);
+
+    for (char *chunk : m_chunks) {
+        ::operator delete(chunk);
+    }
+}
+
+
+void IRArena::release()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    assert(!m_released);
+    m_released = true;
+
+    if (m_numLive == 0) {
+        lock.unlock();
+        delete this;
+    }
+}
+
+
+void *IRArena::allocate(std::size_t numBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_numLive++;
+
+    if (numBytes > MAX_POOLED_SIZE) {
+        return ::operator new(numBytes);
+    }
+
+    const std::size_t sizeClass = (numBytes + GRANULARITY - 1) / GRANULARITY;
+    FreeNode *&freeList         = m_freeLists[sizeClass - 1];
+
+    if (freeList) {
+        FreeNode *node = freeList;
+        freeList       = node->next;
+        return node;
+    }
+
+    return allocateFromChunk(sizeClass * GRANULARITY);
+}
+
+
+void IRArena::deallocate(void *ptr, std::size_t numBytes)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    assert(m_numLive > 0);
+
+    if (numBytes > MAX_POOLED_SIZE) {
+        ::operator delete(ptr);
+    }
+    else {
+        const std::size_t sizeClass = (numBytes + GRANULARITY - 1) / GRANULARITY;
+        FreeNode *node              = static_cast<FreeNode *>(ptr);
+
+        node->next                 = m_freeLists[sizeClass - 1];
+        m_freeLists[sizeClass - 1] = node;
+    }
+
+    if (--m_numLive == 0 && m_released) {
+        lock.unlock();
+        delete this;
+    }
+}
+
+
+void *IRArena::allocateFromChunk(std::size_t numBytes)
+{
+    if (m_cur == nullptr || numBytes > static_cast<std::size_t>(m_end - m_cur)) {
+        // The remainder of the current chunk is wasted; it is at most MAX_POOLED_SIZE bytes.
+        char *chunk = static_cast<char *>(::operator new(CHUNK_SIZE));
+        m_chunks.push_back(chunk);
+        m_reservedBytes += CHUNK_SIZE;
+
+        m_cur = chunk;
+        m_end = chunk + CHUNK_SIZE;
+    }
+
+    void *result = m_cur;
+    m_cur += numBytes;
+    return result;
+}
+
+
+std::size_t IRArena::getNumLiveAllocations() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numLive;
+}
+
+
+std::size_t IRArena::getReservedBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_reservedBytes;
+}
+
+
+IRArena *IRArena::getCurrent()
+{
+    return g_currentArena;
+}
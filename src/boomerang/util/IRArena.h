@@ -0,0 +1,175 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+/**
+ * A memory pool for the IR nodes (expressions and statements) of a single UserProc.
+ *
+ * Nodes are created by bumping a pointer into large chunks of memory.
+ * Freed nodes are put into size-segregated free lists and are reused by later allocations.
+ * The chunks are returned to the system all at once when the owner has released the arena
+ * and the last node allocated from it has been destroyed, so tearing down the IR of a
+ * procedure does not need one heap free per node.
+ *
+ * IR nodes are allocated from the arena that is current at the time of creation
+ * (see \ref IRArena::Scope). If there is no current arena, nodes are allocated
+ * from the global heap as usual.
+ *
+ * Allocation and deallocation are thread safe, since the nodes of a procedure might be
+ * destroyed on a different thread than the one that created them
+ * (e.g. when procedures are lifted concurrently). The current arena is per thread.
+ */
+class BOOMERANG_API IRArena
+{
+public:
+    /// Makes an arena the current arena for IR node creation for the lifetime of the Scope.
+    /// Scopes can be nested; the previously current arena is restored on destruction.
+    class BOOMERANG_API Scope
+    {
+    public:
+        explicit Scope(IRArena *arena);
+        Scope(const Scope &other) = delete;
+        Scope(Scope &&other)      = delete;
+
+        ~Scope();
+
+        Scope &operator=(const Scope &other) = delete;
+        Scope &operator=(Scope &&other) = delete;
+
+    private:
+        IRArena *m_prev;
+    };
+
+public:
+    IRArena();
+    IRArena(const IRArena &other) = delete;
+    IRArena(IRArena &&other)      = delete;
+
+    IRArena &operator=(const IRArena &other) = delete;
+    IRArena &operator=(IRArena &&other) = delete;
+
+private:
+    /// Use release() instead.
+    ~IRArena();
+
+public:
+    /// Give up ownership of this arena. The arena is destroyed as soon as
+    /// there are no more live nodes allocated from it (possibly immediately).
+    void release();
+
+    void *allocate(std::size_t numBytes);
+    void deallocate(void *ptr, std::size_t numBytes);
+
+    /// \returns the number of allocations from this arena that have not been freed yet.
+    std::size_t getNumLiveAllocations() const;
+
+    /// \returns the number of bytes reserved from the system by this arena.
+    std::size_t getReservedBytes() const;
+
+public:
+    /// \returns the arena used for new IR nodes, or nullptr if nodes are allocated from the heap.
+    static IRArena *getCurrent();
+
+    /// Create a shared object of type T, allocated from the current arena if there is one.
+    template<typename T, typename... Args>
+    static std::shared_ptr<T> makeShared(Args &&... args);
+
+private:
+    /// Maximum size of a single allocation served by the arena.
+    /// Larger allocations are forwarded to the global heap.
+    static constexpr std::size_t MAX_POOLED_SIZE  = 256;
+    static constexpr std::size_t GRANULARITY      = alignof(std::max_align_t);
+    static constexpr std::size_t NUM_SIZE_CLASSES = MAX_POOLED_SIZE / GRANULARITY;
+    static constexpr std::size_t CHUNK_SIZE       = 64 * 1024;
+
+    struct FreeNode
+    {
+        FreeNode *next;
+    };
+
+    void *allocateFromChunk(std::size_t numBytes);
+
+private:
+    mutable std::mutex m_mutex; ///< Guards all members below
+    std::vector<char *> m_chunks;
+    char *m_cur = nullptr; ///< next free byte in the current chunk
+    char *m_end = nullptr; ///< end of the current chunk
+    std::array<FreeNode *, NUM_SIZE_CLASSES> m_freeLists;
+
+    std::size_t m_numLive       = 0;
+    std::size_t m_reservedBytes = 0;
+    bool m_released             = false;
+};
+
+
+/// std::allocator compatible adapter for IRArena.
+template<typename T>
+class IRArenaAllocator
+{
+public:
+    typedef T value_type;
+
+public:
+    explicit IRArenaAllocator(IRArena *arena)
+        : m_arena(arena)
+    {
+    }
+
+    template<typename U>
+    IRArenaAllocator(const IRArenaAllocator<U> &other)
+        : m_arena(other.getArena())
+    {
+    }
+
+public:
+    T *allocate(std::size_t n) { return static_cast<T *>(m_arena->allocate(n * sizeof(T))); }
+    void deallocate(T *ptr, std::size_t n) { m_arena->deallocate(ptr, n * sizeof(T)); }
+
+    IRArena *getArena() const { return m_arena; }
+
+    template<typename U>
+    bool operator==(const IRArenaAllocator<U> &other) const
+    {
+        return m_arena == other.getArena();
+    }
+
+    template<typename U>
+    bool operator!=(const IRArenaAllocator<U> &other) const
+    {
+        return m_arena != other.getArena();
+    }
+
+private:
+    IRArena *m_arena;
+};
+
+
+template<typename T, typename... Args>
+std::shared_ptr<T> IRArena::makeShared(Args &&... args)
+{
+    IRArena *arena = getCurrent();
+
+    if (arena) {
+        return std::allocate_shared<T>(IRArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
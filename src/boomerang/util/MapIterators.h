@@ -13,15 +13,17 @@
 #include <iterator>
 
 
+/// Iterates over the values of a map,
+/// or of any other container of key/value pairs (e.g. a sorted vector of pairs).
 template<typename M>
 class MapValueIterator
 {
 public:
-    typedef typename M::mapped_type value_type;
-    typedef typename M::mapped_type &reference;
-    typedef typename M::mapped_type *pointer;
+    typedef typename M::value_type::second_type value_type;
+    typedef typename M::value_type::second_type &reference;
+    typedef typename M::value_type::second_type *pointer;
 
-    typedef typename M::iterator::iterator_category iterator_category;
+    typedef std::bidirectional_iterator_tag iterator_category;
     typedef typename M::iterator::difference_type difference_type;
 
 public:
@@ -68,11 +70,11 @@ template<typename M>
 class MapValueConstIterator
 {
 public:
-    typedef const typename M::mapped_type value_type;
-    typedef const typename M::mapped_type &reference;
-    typedef const typename M::mapped_type *pointer;
+    typedef const typename M::value_type::second_type value_type;
+    typedef const typename M::value_type::second_type &reference;
+    typedef const typename M::value_type::second_type *pointer;
 
-    typedef typename M::const_iterator::iterator_category iterator_category;
+    typedef std::bidirectional_iterator_tag iterator_category;
     typedef typename M::const_iterator::difference_type difference_type;
 
 public:
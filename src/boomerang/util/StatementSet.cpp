@@ -15,3 +15,15 @@ bool lessAssign::operator()(const std::shared_ptr<Assign> &as1,
 {
     return *as1->getLeft() < *as2->getLeft();
 }
+
+
+bool lessAssign::operator()(const std::shared_ptr<Assign> &as, const Exp &loc) const
+{
+    return *as->getLeft() < loc;
+}
+
+
+bool lessAssign::operator()(const Exp &loc, const std::shared_ptr<Assign> &as) const
+{
+    return loc < *as->getLeft();
+}
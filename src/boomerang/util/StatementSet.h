@@ -136,14 +136,14 @@ public:
     /// Find a definition for \p loc on the LHS of each assignment in this set.
     /// If found, return pointer to the Assign with that LHS (else return nullptr)
     template<typename = std::enable_if<std::is_base_of<Assign, T>::value>>
-    std::shared_ptr<Assign> lookupLoc(SharedExp loc)
+    std::shared_ptr<Assign> lookupLoc(const SharedConstExp &loc) const
     {
         if (!loc) {
             return nullptr;
         }
 
-        std::shared_ptr<Assign> as(new Assign(loc, Terminal::get(opWild)));
-        iterator ff = m_set.find(as);
+        // Sorter is transparent (see lessAssign), so this does not need to create an Assign
+        const_iterator ff = m_set.find(*loc);
 
         return (ff != end()) ? *ff : nullptr;
     }
@@ -155,7 +155,12 @@ private:
 
 struct BOOMERANG_API lessAssign
 {
+    /// Allows looking up assignments by their LHS without creating a temporary Assign.
+    typedef void is_transparent;
+
     bool operator()(const std::shared_ptr<Assign> &as1, const std::shared_ptr<Assign> &as2) const;
+    bool operator()(const std::shared_ptr<Assign> &as, const Exp &loc) const;
+    bool operator()(const Exp &loc, const std::shared_ptr<Assign> &as) const;
 };
 
 
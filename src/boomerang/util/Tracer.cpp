@@ -0,0 +1,255 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Tracer.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+
+struct Tracer::ThreadBuffer
+{
+    std::mutex mutex;
+    std::size_t capacity = 0;
+    std::vector<Event> events; ///< Ring buffer of at most \ref capacity events
+    std::size_t next       = 0; ///< Position of the oldest event once the buffer is full
+    std::size_t numDropped = 0;
+
+    void reset(std::size_t newCapacity)
+    {
+        capacity   = std::max<std::size_t>(newCapacity, 1);
+        next       = 0;
+        numDropped = 0;
+        events.clear();
+    }
+};
+
+
+Tracer::Tracer()
+    : m_enabled(false)
+    , m_eventsPerThread(DEFAULT_EVENTS_PER_THREAD)
+    , m_epoch(std::chrono::steady_clock::now())
+{
+}
+
+
+Tracer::~Tracer()
+{
+}
+
+
+Tracer &Tracer::get()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+
+void Tracer::enable(std::size_t eventsPerThread)
+{
+    m_enabled.store(false);
+    m_eventsPerThread.store(eventsPerThread);
+    clear();
+    m_enabled.store(true);
+}
+
+
+void Tracer::disable()
+{
+    m_enabled.store(false);
+}
+
+
+void Tracer::clear()
+{
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+
+    for (const std::unique_ptr<ThreadBuffer> &buffer : m_buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->reset(m_eventsPerThread.load());
+    }
+}
+
+
+int64_t Tracer::now() const
+{
+    const auto elapsed = std::chrono::steady_clock::now() - m_epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+
+void Tracer::addEvent(const char *category, const QString &name, const QString &detail,
+                      int64_t beginNs, int64_t endNs)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    ThreadBuffer *buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+
+    if (buffer->events.size() < buffer->capacity) {
+        buffer->events.push_back({ category, name, detail, beginNs, endNs });
+    }
+    else {
+        // overwrite the oldest event
+        buffer->events[buffer->next] = { category, name, detail, beginNs, endNs };
+        buffer->next                 = (buffer->next + 1) % buffer->capacity;
+        buffer->numDropped++;
+    }
+}
+
+
+std::vector<std::vector<Tracer::Event>> Tracer::getEvents() const
+{
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    std::vector<std::vector<Event>> result;
+    result.reserve(m_buffers.size());
+
+    for (const std::unique_ptr<ThreadBuffer> &buffer : m_buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        result.emplace_back();
+        std::vector<Event> &threadEvents = result.back();
+
+        // The oldest event is at the write position
+        threadEvents.reserve(buffer->events.size());
+        threadEvents.insert(threadEvents.end(), buffer->events.begin() + buffer->next,
+                            buffer->events.end());
+        threadEvents.insert(threadEvents.end(), buffer->events.begin(),
+                            buffer->events.begin() + buffer->next);
+    }
+
+    return result;
+}
+
+
+std::size_t Tracer::getNumDroppedEvents() const
+{
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    std::size_t numDropped = 0;
+
+    for (const std::unique_ptr<ThreadBuffer> &buffer : m_buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        numDropped += buffer->numDropped;
+    }
+
+    return numDropped;
+}
+
+
+QByteArray Tracer::toChromeTrace() const
+{
+    const std::vector<std::vector<Event>> events = getEvents();
+    QJsonArray traceEvents;
+
+    for (std::size_t i = 0; i < events.size(); i++) {
+        const int tid = static_cast<int>(i) + 1;
+
+        QJsonObject threadName;
+        threadName["name"] = "thread_name";
+        threadName["ph"]   = "M";
+        threadName["pid"]  = 1;
+        threadName["tid"]  = tid;
+        threadName["args"] = QJsonObject{ { "name", QString("Thread %1").arg(tid) } };
+        traceEvents.append(threadName);
+
+        for (const Event &event : events[i]) {
+            // Timestamps are in microseconds
+            QJsonObject obj;
+            obj["name"] = event.name;
+            obj["cat"]  = event.category;
+            obj["ph"]   = "X";
+            obj["ts"]   = event.beginNs / 1000.0;
+            obj["dur"]  = (event.endNs - event.beginNs) / 1000.0;
+            obj["pid"]  = 1;
+            obj["tid"]  = tid;
+
+            if (!event.detail.isEmpty()) {
+                obj["args"] = QJsonObject{ { "detail", event.detail } };
+            }
+
+            traceEvents.append(obj);
+        }
+    }
+
+    const qint64 numDropped = static_cast<qint64>(getNumDroppedEvents());
+
+    QJsonObject trace;
+    trace["traceEvents"]     = traceEvents;
+    trace["displayTimeUnit"] = "ms";
+    trace["otherData"]       = QJsonObject{ { "droppedEvents", numDropped } };
+
+    return QJsonDocument(trace).toJson(QJsonDocument::Compact);
+}
+
+
+bool Tracer::writeChromeTrace(const QString &fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+
+    return file.write(toChromeTrace()) != -1;
+}
+
+
+Tracer::ThreadBuffer *Tracer::getThreadBuffer()
+{
+    // Buffers are owned by the tracer and never removed,
+    // so the events of a thread are kept after the thread has finished.
+    static thread_local ThreadBuffer *threadBuffer = nullptr;
+
+    if (!threadBuffer) {
+        std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+        buffer->reset(m_eventsPerThread.load());
+
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        m_buffers.push_back(std::move(buffer));
+        threadBuffer = m_buffers.back().get();
+    }
+
+    return threadBuffer;
+}
+
+
+TraceScope::TraceScope(const char *category, const QString &name, const QString &detail)
+    : m_category(category)
+{
+    if (Tracer::get().isEnabled()) {
+        m_active  = true;
+        m_name    = name;
+        m_detail  = detail;
+        m_beginNs = Tracer::get().now();
+    }
+}
+
+
+TraceScope::TraceScope(const char *category, const char *name, const QString &detail)
+    : m_category(category)
+{
+    if (Tracer::get().isEnabled()) {
+        m_active  = true;
+        m_name    = name;
+        m_detail  = detail;
+        m_beginNs = Tracer::get().now();
+    }
+}
+
+
+TraceScope::~TraceScope()
+{
+    if (m_active) {
+        Tracer::get().addEvent(m_category, m_name, m_detail, m_beginNs, Tracer::get().now());
+    }
+}
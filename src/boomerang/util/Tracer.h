@@ -0,0 +1,145 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/core/BoomerangAPI.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+/**
+ * Records timestamped events of the decompiler (procedures, passes, recursion groups,
+ * code generation) for offline performance analysis.
+ *
+ * Each thread records into its own fixed size ring buffer; when a buffer is full,
+ * the oldest events of that thread are overwritten. The recorded events can be written
+ * in the Chrome trace event format, which can be viewed with chrome://tracing or Perfetto.
+ *
+ * Tracing is disabled by default. When disabled, recording an event
+ * (see \ref TraceScope) is a single atomic load.
+ */
+class BOOMERANG_API Tracer
+{
+public:
+    /// Default capacity of each per-thread ring buffer in number of events.
+    static constexpr std::size_t DEFAULT_EVENTS_PER_THREAD = 1 << 16;
+
+    struct Event
+    {
+        const char *category = ""; ///< Must be a string literal
+        QString name;
+        QString detail;      ///< Optional, e.g. the name of the procedure
+        int64_t beginNs = 0; ///< Nanoseconds since the tracer was created
+        int64_t endNs   = 0;
+    };
+
+private:
+    Tracer();
+
+public:
+    Tracer(const Tracer &other) = delete;
+    Tracer(Tracer &&other)      = delete;
+
+    ~Tracer();
+
+    Tracer &operator=(const Tracer &other) = delete;
+    Tracer &operator=(Tracer &&other) = delete;
+
+public:
+    static Tracer &get();
+
+    /// Start recording events. Already recorded events are discarded.
+    /// \param eventsPerThread Maximum number of events kept for each thread.
+    void enable(std::size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+
+    /// Stop recording events. Already recorded events are kept.
+    void disable();
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Discard all recorded events.
+    void clear();
+
+    /// \returns the current time in nanoseconds since the tracer was created.
+    int64_t now() const;
+
+    /// Record a completed event for the current thread. Does nothing if tracing is disabled.
+    void addEvent(const char *category, const QString &name, const QString &detail,
+                  int64_t beginNs, int64_t endNs);
+
+    /// \returns all events that are still in the ring buffer of each thread,
+    /// oldest first. The outer vector is indexed by thread.
+    std::vector<std::vector<Event>> getEvents() const;
+
+    /// \returns the number of events that were overwritten because a ring buffer was full.
+    std::size_t getNumDroppedEvents() const;
+
+    /// \returns the recorded events in the Chrome trace event format (JSON).
+    QByteArray toChromeTrace() const;
+
+    /// Write the recorded events in the Chrome trace event format to \p fileName.
+    /// \returns false if the file could not be written.
+    bool writeChromeTrace(const QString &fileName) const;
+
+private:
+    struct ThreadBuffer;
+
+    /// \returns the ring buffer of the current thread, creating it if necessary.
+    ThreadBuffer *getThreadBuffer();
+
+private:
+    std::atomic<bool> m_enabled;
+    std::atomic<std::size_t> m_eventsPerThread;
+    const std::chrono::steady_clock::time_point m_epoch;
+
+    mutable std::mutex m_buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers; ///< Buffers are never removed
+};
+
+
+/**
+ * Records an event of the current thread spanning the lifetime of this object.
+ * \code
+ * TraceScope trace("pass", pass->getName(), proc->getName());
+ * \endcode
+ */
+class BOOMERANG_API TraceScope
+{
+public:
+    /// \param category Category of the event, must be a string literal.
+    TraceScope(const char *category, const QString &name, const QString &detail = QString());
+
+    /// Only converts \p name to a QString if tracing is enabled.
+    TraceScope(const char *category, const char *name, const QString &detail = QString());
+
+    TraceScope(const TraceScope &other) = delete;
+    TraceScope(TraceScope &&other)      = delete;
+
+    ~TraceScope();
+
+    TraceScope &operator=(const TraceScope &other) = delete;
+    TraceScope &operator=(TraceScope &&other) = delete;
+
+private:
+    bool m_active = false;
+    const char *m_category;
+    QString m_name;
+    QString m_detail;
+    int64_t m_beginNs = 0;
+};
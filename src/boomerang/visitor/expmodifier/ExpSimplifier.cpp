@@ -21,9 +21,93 @@
 #include "boomerang/util/ByteUtil.h"
 #include "boomerang/util/log/Log.h"
 
+#include <array>
+#include <initializer_list>
+
+
+namespace
+{
+/// Number of entries of tables indexed by OPER
+constexpr std::size_t NUM_OPERS = opFLF + 1;
+
+using OperTable = std::array<bool, NUM_OPERS>;
+
+OperTable makeOperTable(std::initializer_list<OPER> opers)
+{
+    OperTable table;
+    table.fill(false);
+
+    for (OPER oper : opers) {
+        table[oper] = true;
+    }
+
+    return table;
+}
+
+
+/// All comparison operators
+#define COMPARISON_OPERS                                                                           \
+    opEquals, opNotEqual, opLess, opGtr, opLessEq, opGtrEq, opLessUns, opGtrUns, opLessEqUns,      \
+        opGtrEqUns
+
+
+/// \returns true if there is any rule in postModify(Unary) for \p oper
+/// applied to an operand with operator \p subOper.
+bool hasUnaryRule(OPER oper, OPER subOper)
+{
+    static const std::array<OperTable, NUM_OPERS> table = []() {
+        std::array<OperTable, NUM_OPERS> result;
+        result.fill(makeOperTable({}));
+
+        result[opNeg]    = makeOperTable({ opIntConst, opNeg });
+        result[opMemOf]  = makeOperTable({ opAddrOf });
+        result[opAddrOf] = makeOperTable({ opMemOf });
+
+        // opBitXor and opLNot are here because of ~(logexp) -> !(logexp)
+        result[opBitNot] = makeOperTable({ COMPARISON_OPERS, opIntConst, opBitNot, opBitAnd,
+                                           opBitOr, opBitXor, opAnd, opOr, opLNot });
+        result[opLNot]   = makeOperTable({ COMPARISON_OPERS, opIntConst, opLNot, opAnd, opOr });
+
+        return result;
+    }();
+
+    return table[oper][subOper];
+}
+
+
+/// \returns true if there is any rule in postModify(Binary) for \p oper
+/// apart from folding two integer constants.
+bool hasBinaryRule(OPER oper)
+{
+    static const OperTable table = makeOperTable({
+        // arithmetic
+        opPlus, opMinus, opMult, opMults, opDiv, opDivs, opMod, opMods, opShL, opFMinus,
+        // bitwise and logical
+        opBitAnd, opBitOr, opBitXor, opAnd, opOr,
+        // comparisons
+        COMPARISON_OPERS });
+
+    return table[oper];
+}
+
+
+/// \returns true if there is any rule in postModify(Ternary) for \p oper
+bool hasTernaryRule(OPER oper)
+{
+    static const OperTable table = makeOperTable(
+        { opTern, opSgnEx, opZfill, opFsize, opItof, opTruncu, opTruncs, opAt });
+
+    return table[oper];
+}
+}
+
 
 SharedExp ExpSimplifier::postModify(const std::shared_ptr<Unary> &exp)
 {
+    if (!hasUnaryRule(exp->getOper(), exp->getSubExp1()->getOper())) {
+        return exp;
+    }
+
     bool &changed = m_modified;
 
     if (exp->getOper() == opBitNot || exp->getOper() == opLNot) {
@@ -196,6 +280,10 @@ SharedExp ExpSimplifier::postModify(const std::shared_ptr<Binary> &exp)
         }
     }
 
+    if (!hasBinaryRule(exp->getOper())) {
+        return exp;
+    }
+
     if ((exp->getOper() == opBitXor || exp->getOper() == opMinus) &&
         *exp->getSubExp1() == *exp->getSubExp2()) {
         // x ^ x or x - x: result is zero
@@ -503,14 +591,14 @@ SharedExp ExpSimplifier::postModify(const std::shared_ptr<Binary> &exp)
         return Unary::get(opLNot, exp->getSubExp1());
     }
 
-    auto b1 = std::dynamic_pointer_cast<Binary>(exp->getSubExp1());
-    auto b2 = std::dynamic_pointer_cast<Binary>(exp->getSubExp2());
-
+    // Check for (x >= y) || (x == y), becomes x >= y (same for <=, >=u, <=u)
     if ((exp->getOper() == opOr) && (opSub2 == opEquals) &&
         ((opSub1 == opGtrEq) || (opSub1 == opLessEq) || (opSub1 == opGtrEqUns) ||
          (opSub1 == opLessEqUns)) &&
-        (((*b1->getSubExp1() == *b2->getSubExp1()) && (*b1->getSubExp2() == *b2->getSubExp2())) ||
-         ((*b1->getSubExp1() == *b2->getSubExp2()) && (*b1->getSubExp2() == *b2->getSubExp1())))) {
+        (((*exp->access<Exp, 1, 1>() == *exp->access<Exp, 2, 1>()) &&
+          (*exp->access<Exp, 1, 2>() == *exp->access<Exp, 2, 2>())) ||
+         ((*exp->access<Exp, 1, 1>() == *exp->access<Exp, 2, 2>()) &&
+          (*exp->access<Exp, 1, 2>() == *exp->access<Exp, 2, 1>())))) {
         res     = res->getSubExp1();
         changed = true;
         return res;
@@ -659,6 +747,10 @@ SharedExp ExpSimplifier::postModify(const std::shared_ptr<Binary> &exp)
 
 SharedExp ExpSimplifier::postModify(const std::shared_ptr<Ternary> &exp)
 {
+    if (!hasTernaryRule(exp->getOper())) {
+        return exp;
+    }
+
     bool &changed = m_modified;
 
     // p ? 1 : 0 -> p != 0
@@ -0,0 +1,33 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "UsedGlobalFinder.h"
+
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+
+
+UsedGlobalFinder::UsedGlobalFinder(std::set<QString> &used)
+    : m_used(used)
+{
+}
+
+
+bool UsedGlobalFinder::preVisit(const std::shared_ptr<Location> &exp, bool &visitChildren)
+{
+    if (exp->isGlobal()) {
+        m_used.insert(exp->access<Const, 1>()->getStr());
+        visitChildren = false; // the only child is the name of the global
+    }
+    else {
+        visitChildren = true;
+    }
+
+    return true;
+}
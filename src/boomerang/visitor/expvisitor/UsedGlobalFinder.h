@@ -0,0 +1,37 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/visitor/expvisitor/ExpVisitor.h"
+
+#include <QString>
+
+#include <set>
+
+
+/**
+ * Collects the names of all globals (opGlobal locations) used in an expression.
+ * Unlike searchAll with a wildcard pattern, this does not clone or collect
+ * the matching expressions and does not produce duplicates.
+ */
+class BOOMERANG_API UsedGlobalFinder : public ExpVisitor
+{
+public:
+    UsedGlobalFinder(std::set<QString> &used);
+    virtual ~UsedGlobalFinder() = default;
+
+public:
+    /// \copydoc ExpVisitor::preVisit
+    bool preVisit(const std::shared_ptr<Location> &exp, bool &visitChildren) override;
+
+private:
+    std::set<QString> &m_used; ///< Names of the used globals
+};
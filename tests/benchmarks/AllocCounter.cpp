@@ -0,0 +1,97 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+// Replacements for the global allocation functions that count the number of allocations.
+// Only the non-aligned variants are replaced; the others forward to these by default.
+
+static std::atomic<std::uint64_t> g_numAllocations{ 0 };
+
+
+std::uint64_t getNumAllocations()
+{
+    return g_numAllocations.load(std::memory_order_relaxed);
+}
+
+
+static void *countedAlloc(std::size_t size)
+{
+    g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    void *ptr = std::malloc(size != 0 ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+
+void *operator new(std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+
+void *operator new[](std::size_t size)
+{
+    return countedAlloc(size);
+}
+
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return countedAlloc(size);
+    }
+    catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return countedAlloc(size);
+    }
+    catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
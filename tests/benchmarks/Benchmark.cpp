@@ -0,0 +1,134 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+
+namespace
+{
+struct Sample
+{
+    std::int64_t ns;
+    std::uint64_t allocs;
+};
+
+
+Sample measure(const std::function<void()> &op, const std::function<void(std::uint64_t)> &setup,
+               std::uint64_t iterations)
+{
+    if (setup) {
+        setup(iterations);
+    }
+
+    const std::uint64_t allocsBefore = getNumAllocations();
+    const auto start                 = std::chrono::steady_clock::now();
+
+    for (std::uint64_t i = 0; i < iterations; ++i) {
+        op();
+    }
+
+    const auto end                  = std::chrono::steady_clock::now();
+    const std::uint64_t allocsAfter = getNumAllocations();
+
+    return { std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+             allocsAfter - allocsBefore };
+}
+
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+}
+
+
+BenchmarkRunner::BenchmarkRunner(const QString &filter, int minTimeMs, int repetitions)
+    : m_filter(filter)
+    , m_minTimeNs(std::int64_t(minTimeMs) * 1000000)
+    , m_repetitions(std::max(repetitions, 1))
+{
+}
+
+
+void BenchmarkRunner::run(const QString &name, const std::function<void()> &op,
+                          const std::function<void(std::uint64_t)> &setup)
+{
+    if (!m_filter.isEmpty() && !name.contains(m_filter, Qt::CaseInsensitive)) {
+        return;
+    }
+
+    // Calibrate: grow the number of iterations until a single repetition
+    // takes long enough to make timer resolution negligible.
+    std::uint64_t iterations = 1;
+    while (iterations < (std::uint64_t(1) << 30)) {
+        const Sample s = measure(op, setup, iterations);
+        if (s.ns >= m_minTimeNs) {
+            break;
+        }
+        else if (s.ns <= 0) {
+            iterations *= 10;
+            continue;
+        }
+
+        const double scale = 1.4 * double(m_minTimeNs) / double(s.ns);
+        iterations         = std::max(iterations + 1,
+                                      std::uint64_t(double(iterations) * std::min(scale, 10.0)));
+    }
+
+    std::vector<double> nsPerOp, allocsPerOp;
+    for (int rep = 0; rep < m_repetitions; ++rep) {
+        const Sample s = measure(op, setup, iterations);
+        nsPerOp.push_back(double(s.ns) / double(iterations));
+        allocsPerOp.push_back(double(s.allocs) / double(iterations));
+    }
+
+    BenchmarkResult result;
+    result.name        = name;
+    result.iterations  = iterations;
+    result.nsPerOp     = median(nsPerOp);
+    result.allocsPerOp = median(allocsPerOp);
+
+    std::printf("%-48s %12llu %14.1f ns/op %10.2f allocs/op\n", qPrintable(name),
+                static_cast<unsigned long long>(iterations), result.nsPerOp, result.allocsPerOp);
+    std::fflush(stdout);
+
+    m_results.push_back(result);
+}
+
+
+bool BenchmarkRunner::writeResults(const QString &fileName) const
+{
+    QJsonArray results;
+    for (const BenchmarkResult &result : m_results) {
+        QJsonObject obj;
+        obj["name"]        = result.name;
+        obj["iterations"]  = double(result.iterations);
+        obj["nsPerOp"]     = result.nsPerOp;
+        obj["allocsPerOp"] = result.allocsPerOp;
+        results.append(obj);
+    }
+
+    QFile file(fileName);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return false;
+    }
+
+    file.write(QJsonDocument(results).toJson());
+    return true;
+}
@@ -0,0 +1,100 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "boomerang/ssl/exp/ExpHelp.h"
+
+#include <QString>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+/// Number of calls to the global operator new since program start.
+/// Maintained by the replacement allocation functions in AllocCounter.cpp.
+std::uint64_t getNumAllocations();
+
+
+/// Prevent the compiler from optimizing away the computation of \p value.
+template<typename T>
+inline void doNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+
+/// Result of a single benchmark.
+struct BenchmarkResult
+{
+    QString name;
+    std::uint64_t iterations = 0;  ///< iterations per repetition
+    double nsPerOp           = 0;  ///< median over all repetitions
+    double allocsPerOp       = 0;  ///< median over all repetitions
+};
+
+
+/**
+ * Runs micro-benchmarks and prints their results.
+ * The number of iterations is calibrated once per benchmark so that
+ * each repetition takes at least \ref m_minTimeNs; the reported values
+ * are the median of all repetitions.
+ */
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner(const QString &filter, int minTimeMs, int repetitions);
+
+public:
+    /**
+     * Run the benchmark \p name if it matches the filter.
+     * \p op is a single operation; it is called repeatedly.
+     * \p setup is called before each repetition, outside of the measurement,
+     * with the number of iterations that will be run.
+     */
+    void run(const QString &name, const std::function<void()> &op,
+             const std::function<void(std::uint64_t)> &setup = nullptr);
+
+    const std::vector<BenchmarkResult> &getResults() const { return m_results; }
+
+    /// Write all results collected so far as JSON to \p fileName.
+    bool writeResults(const QString &fileName) const;
+
+private:
+    QString m_filter;
+    std::int64_t m_minTimeNs;
+    int m_repetitions;
+    std::vector<BenchmarkResult> m_results;
+};
+
+
+/**
+ * Create \p count pseudo-random expressions typical for lifted machine code
+ * (register and memory locations, address arithmetic, flag calculations).
+ * The result only depends on \p count and \p seed.
+ */
+std::vector<SharedExp> createSyntheticExps(std::size_t count, unsigned int seed = 42);
+
+
+void runExpBenchmarks(BenchmarkRunner &runner);
+void runUtilBenchmarks(BenchmarkRunner &runner);
+void runTypeBenchmarks(BenchmarkRunner &runner);
+/// \returns false if the SSL benchmarks could not be set up.
+bool runSSLBenchmarks(BenchmarkRunner &runner);
+void runDataFlowBenchmarks(BenchmarkRunner &runner);
+
+/// Run benchmarks on the IR of a decoded sample binary (\p samplePath is relative to the samples dir).
+bool runSampleBenchmarks(BenchmarkRunner &runner, const QString &samplePath);
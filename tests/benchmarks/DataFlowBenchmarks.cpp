@@ -0,0 +1,95 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/CFGAnalysis.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Terminal.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+namespace
+{
+IRFragment *createFragment(Prog &prog, UserProc &proc, BBType bbType, Address addr)
+{
+    std::vector<MachineInstruction> insns(1);
+    insns[0].m_addr = addr;
+    insns[0].m_size = 1;
+
+    BasicBlock *bb = prog.getCFG()->createBB(bbType, insns);
+    bb->setProc(&proc);
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    std::unique_ptr<RTL> rtl(new RTL(addr));
+    rtl->append(std::make_shared<Assign>(VoidType::get(), Terminal::get(opNil), Terminal::get(opNil)));
+    rtls->push_back(std::move(rtl));
+
+    return proc.getCFG()->createFragment((FragType)bbType, std::move(rtls), bb);
+}
+
+
+/**
+ * Create a CFG consisting of \p numLoops loops in sequence,
+ * each containing an if-then-else:
+ *
+ *     head -> left, right; left, right -> join; join -> head, next head
+ */
+void createLoopChain(Prog &prog, UserProc &proc, int numLoops)
+{
+    ProcCFG *cfg     = proc.getCFG();
+    IRFragment *prev = nullptr;
+    Address addr     = Address(0x1000);
+
+    for (int i = 0; i < numLoops; ++i) {
+        IRFragment *head  = createFragment(prog, proc, BBType::Twoway, addr);
+        IRFragment *left  = createFragment(prog, proc, BBType::Oneway, addr + 1);
+        IRFragment *right = createFragment(prog, proc, BBType::Oneway, addr + 2);
+        IRFragment *join  = createFragment(prog, proc, BBType::Twoway, addr + 3);
+        addr += 4;
+
+        if (prev) {
+            cfg->addEdge(prev, head);
+        }
+
+        cfg->addEdge(head, left);
+        cfg->addEdge(head, right);
+        cfg->addEdge(left, join);
+        cfg->addEdge(right, join);
+        cfg->addEdge(join, head);
+        prev = join;
+    }
+
+    cfg->addEdge(prev, createFragment(prog, proc, BBType::Ret, addr));
+    proc.setEntryFragment();
+}
+}
+
+
+void runDataFlowBenchmarks(BenchmarkRunner &runner)
+{
+    for (int numLoops : { 4, 64, 1024 }) {
+        Prog prog("bench", nullptr);
+        UserProc proc(Address(0x1000), "bench", nullptr);
+        createLoopChain(prog, proc, numLoops);
+
+        // DataFlow::calculateDominators reuses the analysis cached by the CFG,
+        // so measure building a fresh analysis instead
+        const ProcCFG *cfg = proc.getCFG();
+        runner.run(QString("DataFlow/calculateDominators (%1 frags)").arg(4 * numLoops + 1), [&]() {
+            CFGAnalysis analysis(cfg);
+            doNotOptimize(analysis.isValid());
+        });
+    }
+}
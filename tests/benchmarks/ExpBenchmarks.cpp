@@ -0,0 +1,108 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/exp/Unary.h"
+
+#include <random>
+
+
+namespace
+{
+SharedExp createExp(std::mt19937 &rng, int depth)
+{
+    std::uniform_int_distribution<int> kindDist(0, depth > 0 ? 9 : 2);
+    std::uniform_int_distribution<int> regDist(24, 31);
+    std::uniform_int_distribution<int> constDist(-16, 64);
+
+    switch (kindDist(rng)) {
+    case 0: return Location::regOf(RegNum(regDist(rng)));
+    case 1: return Const::get(constDist(rng));
+    case 2:
+        return Location::memOf(Binary::get(opPlus, Location::regOf(RegNum(regDist(rng))),
+                                           Const::get(4 * constDist(rng))));
+    case 3: return Binary::get(opPlus, createExp(rng, depth - 1), createExp(rng, depth - 1));
+    case 4: return Binary::get(opMinus, createExp(rng, depth - 1), Const::get(constDist(rng)));
+    case 5: return Binary::get(opBitAnd, createExp(rng, depth - 1), Const::get(0xFF));
+    case 6: return Binary::get(opMult, createExp(rng, depth - 1), Const::get(1 << (rng() % 4)));
+    case 7: return Location::memOf(createExp(rng, depth - 1));
+    case 8: return Unary::get(opNeg, createExp(rng, depth - 1));
+    default:
+        return Ternary::get(opTern,
+                            Binary::get(opEquals, createExp(rng, depth - 1), Const::get(0)),
+                            createExp(rng, depth - 1), createExp(rng, depth - 1));
+    }
+}
+}
+
+
+std::vector<SharedExp> createSyntheticExps(std::size_t count, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<SharedExp> result;
+    result.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(createExp(rng, 4));
+    }
+
+    return result;
+}
+
+
+void runExpBenchmarks(BenchmarkRunner &runner)
+{
+    const std::vector<SharedExp> exps = createSyntheticExps(1024);
+    std::size_t i = 0;
+
+    runner.run("Exp/construct", [&]() {
+        SharedExp e = Location::memOf(
+            Binary::get(opPlus, Location::regOf(RegNum(28)), Const::get(int(i++ & 0xFF))));
+        doNotOptimize(e);
+    });
+
+    runner.run("Exp/clone", [&]() {
+        SharedExp e = exps[i++ % exps.size()]->clone();
+        doNotOptimize(e);
+    });
+
+    runner.run("Exp/operator==", [&]() {
+        const bool eq = *exps[i % exps.size()] == *exps[(i + 1) % exps.size()];
+        ++i;
+        doNotOptimize(eq);
+    });
+
+    runner.run("Exp/lessExpStar", [&]() {
+        const bool less = lessExpStar()(exps[i % exps.size()], exps[(i + 7) % exps.size()]);
+        ++i;
+        doNotOptimize(less);
+    });
+
+    // simplify() modifies the expression, so each iteration works on a fresh clone.
+    std::vector<SharedExp> clones;
+    runner.run(
+        "Exp/simplify",
+        [&]() {
+            SharedExp e = clones[i++]->simplify();
+            doNotOptimize(e);
+        },
+        [&](std::uint64_t iterations) {
+            i = 0;
+            clones.clear();
+            clones.reserve(iterations);
+            for (std::uint64_t j = 0; j < iterations; ++j) {
+                clones.push_back(exps[j % exps.size()]->clone());
+            }
+        });
+}
@@ -0,0 +1,108 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/util/log/Log.h"
+
+#include <QCoreApplication>
+#include <QStringList>
+
+#include <cstdio>
+
+
+/// Samples used by --samples. Small enough to keep the run time reasonable,
+/// while covering both supported instruction sets.
+static const char *const defaultSamples[] = {
+    "x86/encrypt",
+    "x86/switch_gcc",
+    "ppc/fibo",
+};
+
+
+static void help()
+{
+    std::printf("Usage: boomerang-bench [options]\n"
+                "  --filter <str>      Only run benchmarks whose name contains <str>\n"
+                "  --min-time <ms>     Minimum duration of a single repetition (default: 200)\n"
+                "  --repetitions <n>   Number of repetitions per benchmark (default: 5)\n"
+                "  --sample <path>     Also run benchmarks on the IR of the sample binary <path>\n"
+                "                      (relative to the samples directory). Can be repeated.\n"
+                "  --samples           Also run benchmarks on the IR of the default sample binaries\n"
+                "  --json <file>       Write the results to <file>\n"
+                "  -h, --help          Display this help\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QString filter, jsonFile;
+    QStringList samples;
+    int minTimeMs   = 200;
+    int repetitions = 5;
+
+    const QStringList args = app.arguments();
+    for (int i = 1; i < args.size(); ++i) {
+        const QString &arg = args[i];
+        const bool hasNext = i + 1 < args.size();
+
+        if (arg == "-h" || arg == "--help") {
+            help();
+            return 0;
+        }
+        else if (arg == "--filter" && hasNext) {
+            filter = args[++i];
+        }
+        else if (arg == "--min-time" && hasNext) {
+            minTimeMs = args[++i].toInt();
+        }
+        else if (arg == "--repetitions" && hasNext) {
+            repetitions = args[++i].toInt();
+        }
+        else if (arg == "--sample" && hasNext) {
+            samples.append(args[++i]);
+        }
+        else if (arg == "--samples") {
+            for (const char *sample : defaultSamples) {
+                samples.append(sample);
+            }
+        }
+        else if (arg == "--json" && hasNext) {
+            jsonFile = args[++i];
+        }
+        else {
+            std::fprintf(stderr, "Unknown or incomplete option '%s'\n", qPrintable(arg));
+            help();
+            return 1;
+        }
+    }
+
+    // No log sinks are added, so that logging does not distort the measurements.
+    Log::getOrCreateLog();
+
+    BenchmarkRunner runner(filter, minTimeMs, repetitions);
+    runExpBenchmarks(runner);
+    runUtilBenchmarks(runner);
+    runTypeBenchmarks(runner);
+    bool ok = runSSLBenchmarks(runner);
+    runDataFlowBenchmarks(runner);
+
+    for (const QString &sample : samples) {
+        ok &= runSampleBenchmarks(runner, sample);
+    }
+
+    if (!jsonFile.isEmpty() && !runner.writeResults(jsonFile)) {
+        std::fprintf(stderr, "Cannot write results to '%s'\n", qPrintable(jsonFile));
+        return 1;
+    }
+
+    return ok ? 0 : 1;
+}
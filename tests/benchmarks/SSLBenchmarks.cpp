@@ -0,0 +1,60 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/RTLInstDict.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+
+#include <cstdio>
+
+
+bool runSSLBenchmarks(BenchmarkRunner &runner)
+{
+    RTLInstDict dict(false);
+    if (!dict.readSSLFile(BOOMERANG_BENCH_BASE "share/boomerang/ssl/x86.ssl")) {
+        std::fprintf(stderr, "Cannot read x86.ssl, skipping SSL benchmarks\n");
+        return true;
+    }
+
+    const std::vector<SharedExp> regArgs = { Location::regOf(REG_X86_EAX),
+                                             Location::regOf(REG_X86_ECX) };
+    const std::vector<SharedExp> memArgs = {
+        Location::memOf(Binary::get(opPlus, Location::regOf(REG_X86_ESP), Const::get(8))),
+        Const::get(0x10)
+    };
+
+    const Address pc(0x08048000);
+
+    // Instruction names are normalized by RTLInstDict::insert (upper case, no dots)
+    const QString regRegName = "ADDREG32REG32";
+    const QString memImmName = "ADDRM32IMM32";
+
+    // Make sure the benchmarks measure instantiation, not the error path of a failed lookup
+    if (!dict.instantiateRTL(regRegName, pc, regArgs) ||
+        !dict.instantiateRTL(memImmName, pc, memArgs)) {
+        std::fprintf(stderr, "Cannot instantiate ADD instructions from x86.ssl\n");
+        return false;
+    }
+
+    runner.run("RTLInstDict/instantiateRTL (reg, reg)", [&]() {
+        std::unique_ptr<RTL> rtl = dict.instantiateRTL(regRegName, pc, regArgs);
+        doNotOptimize(rtl);
+    });
+
+    runner.run("RTLInstDict/instantiateRTL (mem, imm)", [&]() {
+        std::unique_ptr<RTL> rtl = dict.instantiateRTL(memImmName, pc, memArgs);
+        doNotOptimize(rtl);
+    });
+
+    return true;
+}
@@ -0,0 +1,126 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/core/Project.h"
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/module/Module.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ifc/IFrontEnd.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/util/LocationSet.h"
+
+#include <QFileInfo>
+
+#include <cstdio>
+
+
+namespace
+{
+/// Lift all procedures of \p prog and collect the expressions of all assignments.
+void collectExps(Prog *prog, std::vector<SharedExp> &exps, std::vector<SharedExp> &locs)
+{
+    for (const auto &module : prog->getModuleList()) {
+        for (Function *func : *module) {
+            if (func->isLib()) {
+                continue;
+            }
+
+            UserProc *proc = static_cast<UserProc *>(func);
+            if (!prog->getFrontEnd()->liftProc(proc)) {
+                continue;
+            }
+
+            for (const SharedStmt &stmt : proc->getStatements()) {
+                if (stmt->isAssign()) {
+                    const std::shared_ptr<Assign> asgn = std::static_pointer_cast<Assign>(stmt);
+                    locs.push_back(asgn->getLeft());
+                    exps.push_back(asgn->getRight());
+                }
+            }
+        }
+    }
+}
+}
+
+
+bool runSampleBenchmarks(BenchmarkRunner &runner, const QString &samplePath)
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_BENCH_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_BENCH_BASE "lib/boomerang/plugins/");
+    project.getSettings()->setOutputDirectory(QFileInfo("./bench-output/").absoluteFilePath());
+    project.loadPlugins();
+
+    const QString fullPath = project.getSettings()->getDataDirectory().absoluteFilePath(
+        "samples/" + samplePath);
+
+    if (!project.loadBinaryFile(fullPath) || !project.decodeBinaryFile()) {
+        std::fprintf(stderr, "Cannot decode sample '%s'\n", qPrintable(fullPath));
+        return false;
+    }
+
+    std::vector<SharedExp> exps, locs;
+    collectExps(project.getProg(), exps, locs);
+
+    if (exps.empty()) {
+        std::fprintf(stderr, "Sample '%s' does not contain any assignments\n", qPrintable(fullPath));
+        return false;
+    }
+
+    const QString prefix = "Sample/" + samplePath + "/";
+    std::size_t i        = 0;
+
+    runner.run(prefix + "Exp/clone", [&]() {
+        SharedExp e = exps[i++ % exps.size()]->clone();
+        doNotOptimize(e);
+    });
+
+    runner.run(prefix + "Exp/lessExpStar", [&]() {
+        const bool less = lessExpStar()(exps[i % exps.size()], exps[(i + 1) % exps.size()]);
+        ++i;
+        doNotOptimize(less);
+    });
+
+    std::vector<SharedExp> clones;
+    runner.run(
+        prefix + "Exp/simplify",
+        [&]() {
+            SharedExp e = clones[i++]->simplify();
+            doNotOptimize(e);
+        },
+        [&](std::uint64_t iterations) {
+            i = 0;
+            clones.clear();
+            clones.reserve(iterations);
+            for (std::uint64_t j = 0; j < iterations; ++j) {
+                clones.push_back(exps[j % exps.size()]->clone());
+            }
+        });
+
+    LocationSet set;
+    runner.run(
+        prefix + "LocationSet/insert",
+        [&]() {
+            set.insert(locs[i++ % locs.size()]);
+        },
+        [&](std::uint64_t) {
+            i = 0;
+            set.clear();
+        });
+
+    runner.run(prefix + "LocationSet/contains", [&]() {
+        const bool found = set.contains(locs[i++ % locs.size()]);
+        doNotOptimize(found);
+    });
+
+    return true;
+}
@@ -0,0 +1,63 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/ssl/type/ArrayType.h"
+#include "boomerang/ssl/type/CharType.h"
+#include "boomerang/ssl/type/CompoundType.h"
+#include "boomerang/ssl/type/FloatType.h"
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/PointerType.h"
+#include "boomerang/ssl/type/SizeType.h"
+#include "boomerang/ssl/type/UnionType.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+void runTypeBenchmarks(BenchmarkRunner &runner)
+{
+    std::shared_ptr<CompoundType> point = CompoundType::get();
+    point->addMember(IntegerType::get(32, Sign::Signed), "x");
+    point->addMember(IntegerType::get(32, Sign::Signed), "y");
+
+    // Pairs of types as they are met during type analysis
+    const std::vector<std::pair<SharedType, SharedType>> pairs = {
+        { IntegerType::get(32, Sign::Unknown), IntegerType::get(32, Sign::Signed) },
+        { SizeType::get(32), IntegerType::get(32, Sign::Unsigned) },
+        { SizeType::get(32), PointerType::get(CharType::get()) },
+        { VoidType::get(), FloatType::get(64) },
+        { PointerType::get(VoidType::get()), PointerType::get(IntegerType::get(8)) },
+        { IntegerType::get(32), FloatType::get(32) },
+        { ArrayType::get(CharType::get(), 16), ArrayType::get(IntegerType::get(8), 16) },
+        { PointerType::get(point), PointerType::get(VoidType::get()) },
+        { point, IntegerType::get(32, Sign::Signed) },
+    };
+
+    std::size_t i = 0;
+    runner.run("Type/meetWith", [&]() {
+        const auto &p     = pairs[i++ % pairs.size()];
+        bool changed      = false;
+        SharedType result = p.first->meetWith(p.second, changed);
+        doNotOptimize(result);
+    });
+
+    runner.run("Type/meetWith (union)", [&]() {
+        bool changed = false;
+        std::shared_ptr<UnionType> u = UnionType::get({ IntegerType::get(32), FloatType::get(32) });
+
+        SharedType result = u->meetWith(pairs[i++ % pairs.size()].second, changed);
+        doNotOptimize(result);
+    });
+
+    runner.run("Type/operator==", [&]() {
+        const auto &p = pairs[i++ % pairs.size()];
+        const bool eq = *p.first == *p.second;
+        doNotOptimize(eq);
+    });
+}
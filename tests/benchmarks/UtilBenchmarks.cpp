@@ -0,0 +1,128 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "Benchmark.h"
+
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/util/Address.h"
+#include "boomerang/util/IRArena.h"
+#include "boomerang/util/IntervalMap.h"
+#include "boomerang/util/LocationSet.h"
+
+
+namespace
+{
+void runLocationSetBenchmarks(BenchmarkRunner &runner)
+{
+    // Typical contents of a LocationSet: registers and stack locations
+    std::vector<SharedExp> locs;
+    for (int i = 0; i < 256; ++i) {
+        if (i % 4 == 0) {
+            locs.push_back(Location::regOf(RegNum(24 + (i / 4) % 8)));
+        }
+        else {
+            locs.push_back(Location::memOf(
+                Binary::get(opMinus, Location::regOf(RegNum(28)), Const::get(4 * i))));
+        }
+    }
+
+    LocationSet set;
+    std::size_t i = 0;
+
+    runner.run(
+        "LocationSet/insert (64)",
+        [&]() {
+            if ((i % 64) == 0) {
+                set.clear();
+            }
+            set.insert(locs[i++ % locs.size()]);
+        },
+        [&](std::uint64_t) {
+            i = 0;
+            set.clear();
+        });
+
+    LocationSet full;
+    for (const SharedExp &loc : locs) {
+        full.insert(loc);
+    }
+
+    runner.run("LocationSet/contains (hit)", [&]() {
+        const bool found = full.contains(locs[i++ % locs.size()]);
+        doNotOptimize(found);
+    });
+
+    const SharedExp missing = Location::memOf(
+        Binary::get(opPlus, Location::regOf(RegNum(28)), Const::get(4)));
+    runner.run("LocationSet/contains (miss)", [&]() {
+        const bool found = full.contains(missing);
+        doNotOptimize(found);
+    });
+}
+
+
+void runIntervalMapBenchmarks(BenchmarkRunner &runner)
+{
+    for (int numIntervals : { 16, 256, 4096 }) {
+        IntervalMap<Address, int> map;
+        for (int j = 0; j < numIntervals; ++j) {
+            map.insert(Address(0x1000 + 16 * j), Address(0x1000 + 16 * j + 12), j);
+        }
+
+        const Address::value_type end = 0x1000 + 16 * numIntervals;
+        Address::value_type addr      = 0x1000;
+
+        runner.run(QString("IntervalMap/find (%1)").arg(numIntervals), [&]() {
+            auto it = map.find(Address(addr));
+            doNotOptimize(it);
+
+            // step through the map, also hitting the gaps between the intervals
+            addr += 5;
+            if (addr >= end) {
+                addr = 0x1000;
+            }
+        });
+    }
+}
+
+
+void runIRArenaBenchmarks(BenchmarkRunner &runner)
+{
+    // Create and destroy the IR of a typical instruction, e.g. m[r28 - 4] := r24 + 1,
+    // once from the heap and once from an arena (--ir-arena)
+    for (const bool useArena : { false, true }) {
+        IRArena *arena = useArena ? new IRArena : nullptr;
+
+        runner.run(QString("IRArena/create expressions (%1)").arg(useArena ? "arena" : "heap"),
+                   [&]() {
+                       IRArena::Scope scope(arena);
+                       SharedExp lhs = Location::memOf(
+                           Binary::get(opMinus, Location::regOf(RegNum(28)), Const::get(4)));
+                       SharedExp rhs = Binary::get(opPlus, Location::regOf(RegNum(24)),
+                                                   Const::get(1));
+                       doNotOptimize(lhs);
+                       doNotOptimize(rhs);
+                   });
+
+        if (arena) {
+            arena->release();
+        }
+    }
+}
+}
+
+
+void runUtilBenchmarks(BenchmarkRunner &runner)
+{
+    runLocationSetBenchmarks(runner);
+    runIntervalMapBenchmarks(runner);
+    runIRArenaBenchmarks(runner);
+}
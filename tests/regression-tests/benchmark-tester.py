@@ -0,0 +1,247 @@
+#!/usr/bin/env python3
+#
+# This file is part of the Boomerang Decompiler.
+#
+# See the file "LICENSE.TERMS" for information on usage and
+# redistribution of this file, and for a DISCLAIMER OF ALL
+# WARRANTIES.
+#
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+
+# These files are decompiled to measure the performance of Boomerang.
+# They cover all supported architectures and loaders.
+benchmark_tests = [
+    "elf/hello-clang4-dynamic",
+    "elf32-ppc/hello",
+    "elf32-ppc/switch",
+
+    "OSX/banner",
+    "OSX/daysofxmas",
+    "OSX/o4/daysofxmas",
+    "OSX/switch",
+
+    "ppc/fibo",
+    "ppc/o4/switch",
+    "ppc/superstat",
+
+    "x86/ass3.Linux",
+    "x86/encrypt",
+    "x86/fedora3_true",
+    "x86/nestedswitch",
+    "x86/recursion",
+    "x86/suse_true",
+    "x86/switch_gcc",
+
+    "windows/fbranch.exe",
+    "windows/switch_msvc5.exe",
+    "windows/typetest.exe"
+]
+
+# Metrics that are compared against the baseline.
+# Counts (procs, statements, passes) are only reported, since they change
+# whenever the decompilation output changes.
+gated_metrics = [
+    "load",
+    "decode",
+    "decompile",
+    "codegen",
+    "total",
+    "peakRSS"
+]
+
+
+""" Run the command line and return its exit code, wall clock time (ms) and peak RSS (KiB). """
+def run_and_measure(cmdline, stdout, stderr, timeout):
+    start = time.monotonic()
+    proc  = subprocess.Popen(cmdline, stdout=stdout, stderr=stderr)
+
+    if hasattr(os, "wait4"):
+        # Unix: wait4 reports the resource usage of exactly this child
+        deadline = start + timeout
+        while True:
+            pid, status, rusage = os.wait4(proc.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            if time.monotonic() > deadline:
+                proc.kill()
+                pid, status, rusage = os.wait4(proc.pid, 0)
+                break
+            time.sleep(0.01)
+
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") \
+                          else (os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1)
+        peak_rss = rusage.ru_maxrss
+        if sys.platform == "darwin":
+            peak_rss //= 1024 # bytes -> KiB
+    else:
+        proc.wait(timeout=timeout)
+        peak_rss = None
+
+    total_ms = int((time.monotonic() - start) * 1000)
+    return proc.returncode, total_ms, peak_rss
+
+
+""" Decompile a single input binary and return its metrics, or None on failure. """
+def benchmark_single_input(cli_path, input_file, output_path, args):
+    stats_file = os.path.join(output_path, "stats.json")
+    cmdline    = [cli_path] + ['-P', os.path.dirname(cli_path), '-o', output_path,
+                               '--stats', stats_file] + args + [input_file]
+
+    with open(os.path.join(output_path, os.path.basename(input_file) + ".stdout"), "w") as test_stdout, \
+         open(os.path.join(output_path, os.path.basename(input_file) + ".stderr"), "w") as test_stderr:
+        try:
+            result, total_ms, peak_rss = run_and_measure(cmdline, test_stdout, test_stderr, 360)
+        except KeyboardInterrupt:
+            print("\nAborting benchmark at user request\n")
+            sys.exit(2)
+
+    if result != 0 or not os.path.isfile(stats_file):
+        return None
+
+    with open(stats_file, "r") as f:
+        stats = json.load(f)
+
+    metrics = dict(stats.get("phases", {}))
+    metrics["total"]         = total_ms
+    metrics["peakRSS"]       = peak_rss
+    metrics["numProcs"]      = stats.get("numProcs")
+    metrics["numStatements"] = stats.get("numStatements")
+    metrics["passes"]        = stats.get("passes", {})
+    return metrics
+
+
+""" Run all benchmarks and return the results as a dictionary (input file -> metrics). """
+def perform_benchmarks(base_dir, test_input_base, test_list, cli_path, args):
+    results = {}
+
+    sys.stdout.write("Running benchmarks ")
+    for test_file in test_list:
+        input_file = os.path.join(test_input_base, test_file)
+        output_dir = os.path.join(base_dir, "benchmark-outputs", test_file)
+        os.makedirs(output_dir)
+
+        metrics = benchmark_single_input(cli_path, input_file, output_dir, args)
+        results[test_file] = metrics
+
+        sys.stdout.write('.' if metrics is not None else 'f')
+        sys.stdout.flush()
+
+    print("")
+    return results
+
+
+""" Compare the results against the baseline. Returns True if there is no regression. """
+def compare_to_baseline(results, baseline, tolerance, min_ms):
+    regressions = []
+
+    for test_file, metrics in sorted(results.items()):
+        if metrics is None:
+            regressions.append("%s: decompilation failed" % test_file)
+            continue
+
+        base_metrics = baseline.get(test_file)
+        if base_metrics is None:
+            continue # new benchmark, nothing to compare against
+
+        for metric in gated_metrics:
+            new_value = metrics.get(metric)
+            old_value = base_metrics.get(metric)
+            if new_value is None or old_value is None:
+                continue
+
+            # Ignore noise on very short phases
+            if metric != "peakRSS" and max(new_value, old_value) < min_ms:
+                continue
+
+            if new_value > old_value * (1.0 + tolerance):
+                regressions.append("%s: %s %d -> %d (+%.1f%%)" % (test_file, metric,
+                    old_value, new_value, 100.0 * (new_value - old_value) / max(old_value, 1)))
+
+        for metric in ["numProcs", "numStatements"]:
+            if metrics.get(metric) != base_metrics.get(metric):
+                print("Note: %s: %s changed from %s to %s" % (test_file, metric,
+                    base_metrics.get(metric), metrics.get(metric)))
+
+    if len(regressions) != 0:
+        print("\nPerformance regressions (tolerance %.0f%%):" % (100.0 * tolerance))
+        for reg in regressions:
+            print("  " + reg)
+        print("")
+
+    sys.stdout.flush()
+    return len(regressions) == 0
+
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Boomerang performance benchmark")
+    parser.add_argument("cli_path", help="Path to the boomerang-cli executable")
+    parser.add_argument("--baseline", default="benchmark-baseline.json",
+                        help="Baseline results to compare against")
+    parser.add_argument("--output", default="benchmark-results.json",
+                        help="Where to write the results of this run")
+    parser.add_argument("--tolerance", type=float, default=0.15,
+                        help="Allowed relative slowdown before a metric counts as regression")
+    parser.add_argument("--min-ms", type=int, default=50,
+                        help="Ignore time metrics where both values are below this limit")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Replace the baseline by the results of this run")
+    options, args = parser.parse_known_args()
+
+    print("")
+    print("Boomerang Benchmark")
+    print("===================")
+    print("")
+
+    # ${CMAKE_BINARY_DIR}/tests/regression-tests
+    base_dir = os.getcwd()
+    tests_input_base = os.path.abspath(os.path.join(os.getcwd(), "../../out/share/boomerang/samples/"))
+
+    output_dir = os.path.join(base_dir, "benchmark-outputs")
+    if os.path.isdir(output_dir): shutil.rmtree(output_dir, ignore_errors=True)
+    os.makedirs(output_dir)
+
+    results = perform_benchmarks(base_dir, tests_input_base, benchmark_tests, options.cli_path, args)
+
+    with open(options.output, "w") as f:
+        json.dump(results, f, indent=4, sort_keys=True)
+    print("Results written to '%s'" % os.path.abspath(options.output))
+
+    failed = sorted(test_file for test_file, metrics in results.items() if metrics is None)
+    if len(failed) != 0:
+        print("\nDecompilation failed for:")
+        for test_file in failed:
+            print("  " + test_file)
+        print("")
+        sys.exit(1)
+
+    if options.update_baseline:
+        shutil.copyfile(options.output, options.baseline)
+        print("Baseline '%s' updated.\n" % os.path.abspath(options.baseline))
+        sys.exit(0)
+
+    if not os.path.isfile(options.baseline):
+        print("No baseline found at '%s'; run with --update-baseline to create one.\n" %
+              os.path.abspath(options.baseline))
+        sys.exit(1)
+
+    with open(options.baseline, "r") as f:
+        baseline = json.load(f)
+
+    all_ok = compare_to_baseline(results, baseline, options.tolerance, options.min_ms)
+    print("Benchmark finished.\n")
+
+    sys.exit(not all_ok) # Return with 0 exit status if there is no regression
+
+
+
+if __name__ == "__main__":
+    main()
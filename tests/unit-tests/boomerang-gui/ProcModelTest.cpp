@@ -0,0 +1,216 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ProcModelTest.h"
+
+
+#include "boomerang-gui/LibProcModel.h"
+#include "boomerang-gui/ProcTreeModel.h"
+#include "boomerang-gui/UserProcModel.h"
+
+#include <QSignalSpy>
+
+
+void ProcModelTest::testUserProcAdd()
+{
+    UserProcModel model;
+    QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+
+    QVERIFY(model.addProc("main", Address(0x1000)));
+    QVERIFY(model.addProc("foo", Address(0x2000)));
+    QVERIFY(!model.addProc("main", Address(0x3000))); // same name
+    QVERIFY(!model.addProc("bar", Address(0x2000)));  // same address
+
+    // new rows only become visible in batches
+    QCOMPARE(model.getNumProcs(), 2);
+    QCOMPARE(model.rowCount(), 0);
+
+    model.flush();
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(inserted.count(), 1);
+
+    QCOMPARE(model.data(model.index(0, UserProcModel::ColAddress)).toString(),
+             Address(0x1000).toString());
+    QCOMPARE(model.data(model.index(1, UserProcModel::ColName)).toString(), QString("foo"));
+
+    model.clear();
+    QCOMPARE(model.getNumProcs(), 0);
+    QCOMPARE(model.rowCount(), 0);
+    QVERIFY(model.addProc("main", Address(0x1000)));
+}
+
+
+void ProcModelTest::testUserProcRemove()
+{
+    UserProcModel model;
+    model.addProc("a", Address(0x1000));
+    model.addProc("b", Address(0x2000));
+    model.addProc("c", Address(0x3000));
+    model.flush();
+
+    QVERIFY(model.removeProc(Address(0x1000)));
+    QVERIFY(!model.removeProc(Address(0x1000)));
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.getProcName(0), QString("b"));
+
+    // the indexes of the remaining rows must have been updated
+    QVERIFY(model.removeProc(Address(0x3000)));
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.getProcName(0), QString("b"));
+    QVERIFY(model.addProc("c", Address(0x3000)));
+}
+
+
+void ProcModelTest::testUserProcRename()
+{
+    UserProcModel model;
+    model.addProc("a", Address(0x1000));
+    model.addProc("b", Address(0x2000));
+    model.flush();
+
+    QSignalSpy renamed(&model, &UserProcModel::procRenamed);
+    const QModelIndex idx = model.index(0, UserProcModel::ColName);
+
+    QVERIFY(!model.setData(idx, "b")); // name already taken
+    QVERIFY(model.setData(idx, "c"));
+    QCOMPARE(renamed.count(), 1);
+    QCOMPARE(renamed.first().at(0).toString(), QString("a"));
+    QCOMPARE(renamed.first().at(1).toString(), QString("c"));
+
+    QCOMPARE(model.getProcName(0), QString("c"));
+    QVERIFY(model.addProc("a", Address(0x3000)));
+    QVERIFY(!model.addProc("c", Address(0x4000)));
+}
+
+
+void ProcModelTest::testUserProcDebug()
+{
+    UserProcModel model;
+    model.addProc("a", Address(0x1000));
+    model.addProc("b", Address(0x2000));
+    model.flush();
+
+    QVERIFY(model.isDebugEnabled("a"));
+    QVERIFY(model.isDebugEnabled("unknown"));
+
+    model.setData(model.index(0, UserProcModel::ColDebug), Qt::Unchecked, Qt::CheckStateRole);
+    QVERIFY(!model.isDebugEnabled("a"));
+    QVERIFY(model.isDebugEnabled("b"));
+
+    model.toggleDebugEnabled();
+    QVERIFY(model.isDebugEnabled("a"));
+    QVERIFY(!model.isDebugEnabled("b"));
+
+    QCOMPARE(model.columnCount(), 3);
+    model.setDebugColumnVisible(false);
+    QCOMPARE(model.columnCount(), 2);
+}
+
+
+void ProcModelTest::testLibProcAddOrUpdate()
+{
+    LibProcModel model;
+    QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+
+    model.addOrUpdateProc("printf", "<unknown>");
+    model.addOrUpdateProc("puts", "char *s");
+    model.addOrUpdateProc("printf", "char *fmt, ...");
+    QCOMPARE(changed.count(), 0); // not yet visible
+
+    model.flush();
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.getProcParams(0), QString("char *fmt, ..."));
+
+    model.addOrUpdateProc("puts", "const char *s");
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(model.data(model.index(1, LibProcModel::ColParams)).toString(),
+             QString("const char *s"));
+}
+
+
+void ProcModelTest::testLibProcRemove()
+{
+    LibProcModel model;
+    model.addOrUpdateProc("a", "");
+    model.addOrUpdateProc("b", "");
+    model.flush();
+    model.addOrUpdateProc("c", "");
+
+    QVERIFY(model.removeProc("a"));
+    QVERIFY(!model.removeProc("a"));
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.getNumProcs(), 2);
+
+    // pending rows can be removed as well
+    QVERIFY(model.removeProc("c"));
+    model.flush();
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.getProcName(0), QString("b"));
+}
+
+
+void ProcModelTest::testProcTree()
+{
+    ProcTreeModel model;
+
+    const QModelIndex mainIdx = model.addProc("", "main");
+    QVERIFY(mainIdx.isValid());
+    QVERIFY(!model.addProc("", "main").isValid());
+    QVERIFY(!model.addProc("unknown", "foo").isValid());
+
+    const QModelIndex fooIdx = model.addProc("main", "foo");
+    const QModelIndex barIdx = model.addProc("foo", "bar");
+    model.addProc("main", "baz");
+
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.rowCount(mainIdx), 2);
+    QCOMPARE(model.parent(barIdx), fooIdx);
+    QCOMPARE(model.parent(fooIdx), mainIdx);
+    QCOMPARE(model.getProcName(model.index(1, 0, mainIdx)), QString("baz"));
+    QCOMPARE(model.findProc("bar"), barIdx);
+
+    QVERIFY(!model.data(barIdx, Qt::ForegroundRole).isValid());
+    QCOMPARE(model.setDecompiling("bar"), barIdx);
+    QVERIFY(model.data(barIdx, Qt::ForegroundRole).isValid());
+    QVERIFY(!model.setDecompiling("unknown").isValid());
+
+    model.clear();
+    QCOMPARE(model.rowCount(), 0);
+    QVERIFY(!model.findProc("main").isValid());
+}
+
+
+void ProcModelTest::testManyProcs()
+{
+    const int numProcs = 50000;
+
+    UserProcModel userProcs;
+    ProcTreeModel procTree;
+    QSignalSpy inserted(&userProcs, &QAbstractItemModel::rowsInserted);
+
+    procTree.addProc("", "proc0");
+
+    for (int i = 0; i < numProcs; i++) {
+        const QString name = QString("proc%1").arg(i);
+        userProcs.addProc(name, Address(0x1000 + i * 0x10));
+
+        if (i > 0) {
+            procTree.addProc(QString("proc%1").arg(i / 2), name);
+        }
+    }
+
+    userProcs.flush();
+    QCOMPARE(userProcs.rowCount(), numProcs);
+    QCOMPARE(inserted.count(), 1);
+    QVERIFY(procTree.findProc(QString("proc%1").arg(numProcs - 1)).isValid());
+}
+
+
+QTEST_GUILESS_MAIN(ProcModelTest)
@@ -10,6 +10,7 @@
 #include "CapstonePPCDecoderTest.h"
 
 #include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/util/Types.h"
 
 
@@ -54,6 +55,67 @@ void CapstonePPCDecoderTest::testInstructions()
 }
 
 
+void CapstonePPCDecoderTest::testTemplateID()
+{
+    const InstructionData add1{ "\x7c\x01\x12\x14" }; // add r0, r1, r2
+    const InstructionData add2{ "\x7c\x43\x22\x14" }; // add r2, r3, r4
+    const InstructionData addq{ "\x7c\x01\x12\x15" }; // add. r0, r1, r2
+
+    const Address sourceAddr = Address(0x1000);
+    MachineInstruction insn1, insn2, insn3;
+
+    QVERIFY(m_decoder->disassembleInstruction(
+        sourceAddr, (HostAddress(&add1) - sourceAddr).value(), insn1));
+    QVERIFY(m_decoder->disassembleInstruction(
+        sourceAddr, (HostAddress(&add2) - sourceAddr).value(), insn2));
+    QVERIFY(m_decoder->disassembleInstruction(
+        sourceAddr, (HostAddress(&addq) - sourceAddr).value(), insn3));
+
+    QVERIFY(insn1.m_templateID != MachineInstruction::INVALID_TEMPLATE);
+    QCOMPARE(insn1.m_templateID, insn2.m_templateID);
+    QCOMPARE(insn1.m_templateName, QString("ADD"));
+    QCOMPARE(insn2.m_templateName, QString("ADD"));
+
+    QVERIFY(insn3.m_templateID != insn1.m_templateID);
+    QCOMPARE(insn3.m_templateName, QString("ADDq"));
+}
+
+
+void CapstonePPCDecoderTest::testRequestedCallees()
+{
+    const InstructionData bl{ "\x48\x00\x10\x01" }; // bl 0x2000
+    const InstructionData add{ "\x7c\x01\x12\x14" }; // add r0, r1, r2
+
+    const Address sourceAddr = Address(0x1000);
+
+    {
+        MachineInstruction insn;
+        LiftedInstruction lifted;
+
+        QVERIFY(m_decoder->disassembleInstruction(
+            sourceAddr, (HostAddress(&bl) - sourceAddr).value(), insn));
+        QVERIFY(m_decoder->liftInstruction(insn, lifted));
+
+        QCOMPARE(lifted.getRequestedCallees().size(), std::size_t(1));
+
+        const std::shared_ptr<CallStatement> &call = lifted.getRequestedCallees().front();
+        QCOMPARE(call->getFixedDest(), Address(0x2000));
+        QVERIFY(call->getDestProc() == nullptr);
+    }
+
+    {
+        MachineInstruction insn;
+        LiftedInstruction lifted;
+
+        QVERIFY(m_decoder->disassembleInstruction(
+            sourceAddr, (HostAddress(&add) - sourceAddr).value(), insn));
+        QVERIFY(m_decoder->liftInstruction(insn, lifted));
+
+        QVERIFY(lifted.getRequestedCallees().empty());
+    }
+}
+
+
 void CapstonePPCDecoderTest::testInstructions_data()
 {
     QTest::addColumn<InstructionData>("insnData");
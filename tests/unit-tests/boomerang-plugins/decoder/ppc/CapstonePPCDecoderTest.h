@@ -23,6 +23,11 @@ private slots:
     void testInstructions();
     void testInstructions_data();
 
+    void testTemplateID();
+
+    /// Test that static calls request their callee instead of creating it
+    void testRequestedCallees();
+
 private:
     IDecoder *m_decoder;
 };
@@ -0,0 +1,130 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DefCollectorTest.h"
+
+
+#include "boomerang/db/DefCollector.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/statements/Assign.h"
+
+
+void DefCollectorTest::testCollectDef()
+{
+    const SharedExp eax = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx = Location::regOf(REG_X86_ECX);
+
+    DefCollector col;
+    QVERIFY(col.begin() == col.end());
+
+    col.collectDef(std::make_shared<Assign>(ecx, eax));
+    QCOMPARE(std::distance(col.begin(), col.end()), 1);
+
+    // the LHS is already defined
+    col.collectDef(std::make_shared<Assign>(ecx->clone(), ecx));
+    QCOMPARE(std::distance(col.begin(), col.end()), 1);
+    QCOMPARE(*col.findDefFor(ecx), *eax);
+
+    col.clear();
+    QVERIFY(col.begin() == col.end());
+}
+
+
+void DefCollectorTest::testHasDefOf()
+{
+    const SharedExp eax = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx = Location::regOf(REG_X86_ECX);
+    const SharedExp edx = Location::regOf(REG_X86_EDX);
+
+    DefCollector col;
+    QVERIFY(!col.hasDefOf(nullptr));
+    QVERIFY(!col.hasDefOf(ecx));
+
+    col.collectDef(std::make_shared<Assign>(ecx, eax));
+    QVERIFY(col.hasDefOf(ecx));
+    QVERIFY(col.hasDefOf(ecx->clone()));
+    QVERIFY(!col.hasDefOf(eax));
+
+    // edx@[0:7] also defines edx
+    const SharedExp edxLow = Ternary::get(opAt, edx, Const::get(0), Const::get(7));
+    col.collectDef(std::make_shared<Assign>(edxLow, eax));
+    QVERIFY(col.hasDefOf(edxLow));
+    QVERIFY(col.hasDefOf(edx));
+    QVERIFY(!col.hasDefOf(eax));
+
+    // edx is already defined by edx@[0:7]
+    col.collectDef(std::make_shared<Assign>(edx, ecx));
+    QCOMPARE(std::distance(col.begin(), col.end()), 2);
+
+    col.clear();
+    QVERIFY(!col.hasDefOf(edxLow));
+    QVERIFY(!col.hasDefOf(edx));
+}
+
+
+void DefCollectorTest::testFindDefFor()
+{
+    const SharedExp eax = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx = Location::regOf(REG_X86_ECX);
+
+    DefCollector col;
+    QVERIFY(col.findDefFor(ecx) == nullptr);
+
+    col.collectDef(std::make_shared<Assign>(ecx, eax));
+    QVERIFY(col.findDefFor(ecx) != nullptr);
+    QCOMPARE(*col.findDefFor(ecx), *eax);
+    QVERIFY(col.findDefFor(eax) == nullptr);
+}
+
+
+void DefCollectorTest::testMakeCloneOf()
+{
+    const SharedExp eax    = Location::regOf(REG_X86_EAX);
+    const SharedExp edx    = Location::regOf(REG_X86_EDX);
+    const SharedExp edxLow = Ternary::get(opAt, edx, Const::get(0), Const::get(7));
+
+    DefCollector col1;
+    col1.collectDef(std::make_shared<Assign>(edxLow, eax));
+
+    DefCollector col2;
+    col2.makeCloneOf(col1);
+    QCOMPARE(std::distance(col2.begin(), col2.end()), 1);
+    QVERIFY(*col2.begin() != *col1.begin());
+    QVERIFY(col2.hasDefOf(edxLow));
+    QVERIFY(col2.hasDefOf(edx));
+}
+
+
+void DefCollectorTest::testSearchAndReplace()
+{
+    const SharedExp eax    = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx    = Location::regOf(REG_X86_ECX);
+    const SharedExp edx    = Location::regOf(REG_X86_EDX);
+    const SharedExp edxLow = Ternary::get(opAt, edx, Const::get(0), Const::get(7));
+
+    DefCollector col;
+    col.collectDef(std::make_shared<Assign>(eax, Const::get(1)));
+    col.collectDef(std::make_shared<Assign>(ecx, Const::get(2)));
+    QVERIFY(!col.searchAndReplace(*edx, eax));
+
+    // The LHS changes from eax to edx@[0:7], so the defs must be re-sorted
+    QVERIFY(col.searchAndReplace(*eax, edxLow));
+    QVERIFY(col.findDefFor(eax) == nullptr);
+    QVERIFY(col.findDefFor(edxLow) != nullptr);
+    QCOMPARE(*col.findDefFor(edxLow), *Const::get(1));
+    QCOMPARE(*col.findDefFor(ecx), *Const::get(2));
+
+    // edx@[0:7] also defines edx
+    QVERIFY(col.hasDefOf(edx));
+}
+
+
+QTEST_GUILESS_MAIN(DefCollectorTest)
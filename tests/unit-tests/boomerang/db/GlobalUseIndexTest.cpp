@@ -0,0 +1,130 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "GlobalUseIndexTest.h"
+
+
+#include "boomerang/db/GlobalUseIndex.h"
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/statements/ImplicitAssign.h"
+#include "boomerang/util/StatementList.h"
+
+
+void GlobalUseIndexTest::testUpdateUses()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb = prog.getCFG()->createBB(BBType::Ret, createInsns(Address(0x1000), 1));
+
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    std::shared_ptr<Assign> asgn(new Assign(Location::regOf(REG_X86_EAX),
+                                            Location::global("foo", &proc)));
+    std::shared_ptr<ImplicitAssign> imp(new ImplicitAssign(Location::global("bar", &proc)));
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { imp, asgn })));
+    proc.getCFG()->createFragment(FragType::Ret, std::move(rtls), bb);
+
+    GlobalUseIndex index;
+    QVERIFY(!index.isUsed("foo"));
+
+    index.updateUses(&proc);
+    QVERIFY(index.isUsed("foo"));
+    QVERIFY(!index.isUsed("bar")); // uses in implicit assignments do not count
+    QCOMPARE(index.getNumUsedGlobals(), std::size_t(1));
+    QCOMPARE(index.getUsers("foo").size(), std::size_t(1));
+    QVERIFY(*index.getUsers("foo").begin() == &proc);
+    QVERIFY(index.getUsers("bar").empty());
+
+    // re-indexing after a change only reflects the new state
+    asgn->setRight(Location::global("baz", &proc));
+    index.updateUses(&proc);
+    QVERIFY(!index.isUsed("foo"));
+    QVERIFY(index.isUsed("baz"));
+    QCOMPARE(index.getUsedGlobals(&proc).size(), std::size_t(1));
+}
+
+
+void GlobalUseIndexTest::testRemoveUses()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb1 = prog.getCFG()->createBB(BBType::Ret, createInsns(Address(0x1000), 1));
+    BasicBlock *bb2 = prog.getCFG()->createBB(BBType::Ret, createInsns(Address(0x2000), 1));
+
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+
+    std::unique_ptr<RTLList> rtls1(new RTLList);
+    rtls1->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), {
+        std::make_shared<Assign>(Location::global("foo", &proc1), Const::get(0))
+    })));
+    proc1.getCFG()->createFragment(FragType::Ret, std::move(rtls1), bb1);
+
+    std::unique_ptr<RTLList> rtls2(new RTLList);
+    rtls2->push_back(std::unique_ptr<RTL>(new RTL(Address(0x2000), {
+        std::make_shared<Assign>(Location::global("foo", &proc2), Location::global("bar", &proc2))
+    })));
+    proc2.getCFG()->createFragment(FragType::Ret, std::move(rtls2), bb2);
+
+    GlobalUseIndex index;
+    index.updateUses(&proc1);
+    index.updateUses(&proc2);
+    QCOMPARE(index.getUsers("foo").size(), std::size_t(2));
+    QCOMPARE(index.getUsers("bar").size(), std::size_t(1));
+
+    index.removeUses(&proc2);
+    QCOMPARE(index.getUsers("foo").size(), std::size_t(1));
+    QVERIFY(!index.isUsed("bar"));
+    QVERIFY(index.getUsedGlobals(&proc2).empty());
+
+    index.clear();
+    QVERIFY(!index.isUsed("foo"));
+}
+
+
+void GlobalUseIndexTest::testFindUsingStatements()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb = prog.getCFG()->createBB(BBType::Ret, createInsns(Address(0x1000), 1));
+
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    std::shared_ptr<Assign> asgn1(new Assign(Location::regOf(REG_X86_EAX),
+                                             Binary::get(opPlus,
+                                                         Location::global("foo", &proc),
+                                                         Const::get(1))));
+    std::shared_ptr<Assign> asgn2(new Assign(Location::regOf(REG_X86_ECX), Const::get(2)));
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { asgn1, asgn2 })));
+    proc.getCFG()->createFragment(FragType::Ret, std::move(rtls), bb);
+
+    GlobalUseIndex index;
+    index.updateUses(&proc);
+
+    StatementList stmts;
+    index.findUsingStatements("foo", stmts);
+    QCOMPARE(stmts.size(), std::size_t(1));
+    QVERIFY(*stmts.begin() == asgn1);
+
+    stmts.clear();
+    index.findUsingStatements("bar", stmts);
+    QVERIFY(stmts.empty());
+}
+
+
+QTEST_GUILESS_MAIN(GlobalUseIndexTest)
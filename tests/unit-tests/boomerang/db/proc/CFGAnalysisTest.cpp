@@ -0,0 +1,181 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "CFGAnalysisTest.h"
+
+
+#include "boomerang/db/BasicBlock.h"
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/CFGAnalysis.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/RTL.h"
+
+
+static IRFragment *createFragment(Prog *prog, UserProc *proc, FragType fragType, Address addr)
+{
+    BasicBlock *bb = prog->getCFG()->createBB((BBType)fragType, createInsns(addr, 1));
+    bb->setProc(proc);
+    return proc->getCFG()->createFragment(fragType, createRTLs(addr, 1, 1), bb);
+}
+
+
+void CFGAnalysisTest::testEmpty()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    std::shared_ptr<const CFGAnalysis> analysis = proc.getCFG()->getAnalysis();
+    QVERIFY(analysis != nullptr);
+    QVERIFY(!analysis->isValid());
+    QCOMPARE(analysis->getNumFragments(), std::size_t(0));
+    QCOMPARE(analysis->fragToIdx(nullptr), INDEX_INVALID);
+}
+
+
+void CFGAnalysisTest::testDepthFirstOrder()
+{
+    Prog prog("test", nullptr);
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    IRFragment *entry = createFragment(&prog, &proc, FragType::Twoway, Address(0x1000));
+    IRFragment *a     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1001));
+    IRFragment *b     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1002));
+    IRFragment *c     = createFragment(&prog, &proc, FragType::Ret, Address(0x1003));
+    IRFragment *d     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1004));
+
+    cfg->addEdge(entry, a);
+    cfg->addEdge(entry, b);
+    cfg->addEdge(a, c);
+    cfg->addEdge(b, c);
+    cfg->addEdge(d, c); // d is unreachable
+    proc.setEntryFragment();
+
+    std::shared_ptr<const CFGAnalysis> analysis = cfg->getAnalysis();
+    QVERIFY(analysis->isValid());
+    QCOMPARE(analysis->getNumFragments(), std::size_t(5));
+
+    // fragments are numbered in CFG order
+    const FragIndex entryIdx = analysis->fragToIdx(entry);
+    const FragIndex aIdx     = analysis->fragToIdx(a);
+    const FragIndex bIdx     = analysis->fragToIdx(b);
+    const FragIndex cIdx     = analysis->fragToIdx(c);
+    const FragIndex dIdx     = analysis->fragToIdx(d);
+
+    QCOMPARE(entryIdx, FragIndex(0));
+    QCOMPARE(analysis->idxToFrag(cIdx), c);
+
+    QCOMPARE(analysis->getPreOrderNum(entryIdx), FragIndex(0));
+    QCOMPARE(analysis->getPreOrderNum(aIdx), FragIndex(1));
+    QCOMPARE(analysis->getPreOrderNum(cIdx), FragIndex(2));
+    QCOMPARE(analysis->getPreOrderNum(bIdx), FragIndex(3));
+
+    QCOMPARE(analysis->getPostOrder(), std::vector<FragIndex>({ cIdx, aIdx, bIdx, entryIdx }));
+    QCOMPARE(analysis->getRevPostOrderNum(entryIdx), FragIndex(0));
+    QCOMPARE(analysis->getRevPostOrderNum(bIdx), FragIndex(1));
+    QCOMPARE(analysis->getRevPostOrderNum(aIdx), FragIndex(2));
+    QCOMPARE(analysis->getRevPostOrderNum(cIdx), FragIndex(3));
+
+    QVERIFY(analysis->isReachable(cIdx));
+    QVERIFY(!analysis->isReachable(dIdx));
+    QCOMPARE(analysis->getPreOrderNum(dIdx), INDEX_INVALID);
+    QCOMPARE(analysis->getRevPostOrderNum(dIdx), INDEX_INVALID);
+}
+
+
+void CFGAnalysisTest::testDominators()
+{
+    Prog prog("test", nullptr);
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    IRFragment *entry = createFragment(&prog, &proc, FragType::Twoway, Address(0x1000));
+    IRFragment *a     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1001));
+    IRFragment *b     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1002));
+    IRFragment *c     = createFragment(&prog, &proc, FragType::Ret, Address(0x1003));
+    IRFragment *d     = createFragment(&prog, &proc, FragType::Oneway, Address(0x1004));
+
+    cfg->addEdge(entry, a);
+    cfg->addEdge(entry, b);
+    cfg->addEdge(a, c);
+    cfg->addEdge(b, c);
+    cfg->addEdge(d, c); // d is unreachable
+    proc.setEntryFragment();
+
+    std::shared_ptr<const CFGAnalysis> analysis = cfg->getAnalysis();
+    QVERIFY(analysis->isValid());
+
+    const FragIndex entryIdx = analysis->fragToIdx(entry);
+    const FragIndex aIdx     = analysis->fragToIdx(a);
+    const FragIndex bIdx     = analysis->fragToIdx(b);
+    const FragIndex cIdx     = analysis->fragToIdx(c);
+    const FragIndex dIdx     = analysis->fragToIdx(d);
+
+    QCOMPARE(analysis->getIdom(entryIdx), entryIdx);
+    QCOMPARE(analysis->getIdom(aIdx), entryIdx);
+    QCOMPARE(analysis->getIdom(bIdx), entryIdx);
+    QCOMPARE(analysis->getIdom(cIdx), entryIdx);
+    QCOMPARE(analysis->getIdom(dIdx), INDEX_INVALID);
+
+    // the unreachable predecessor must not become the semi-dominator
+    QCOMPARE(analysis->getSemi(cIdx), entryIdx);
+
+    QCOMPARE(analysis->getDomChildren(entryIdx), std::vector<FragIndex>({ aIdx, bIdx, cIdx }));
+    QCOMPARE(analysis->getDomChildren(aIdx), std::vector<FragIndex>({}));
+
+    QVERIFY(analysis->strictlyDominates(entryIdx, cIdx));
+    QVERIFY(!analysis->strictlyDominates(aIdx, cIdx));
+    QVERIFY(!analysis->strictlyDominates(cIdx, cIdx));
+    QVERIFY(!analysis->strictlyDominates(entryIdx, dIdx));
+
+    QCOMPARE(analysis->getDominanceFrontier(entryIdx), std::set<FragIndex>({}));
+    QCOMPARE(analysis->getDominanceFrontier(aIdx), std::set<FragIndex>({ cIdx }));
+    QCOMPARE(analysis->getDominanceFrontier(bIdx), std::set<FragIndex>({ cIdx }));
+    QCOMPARE(analysis->getDominanceFrontier(cIdx), std::set<FragIndex>({}));
+}
+
+
+void CFGAnalysisTest::testCache()
+{
+    Prog prog("test", nullptr);
+    UserProc proc(Address(0x1000), "test", nullptr);
+    ProcCFG *cfg = proc.getCFG();
+
+    IRFragment *entry = createFragment(&prog, &proc, FragType::Oneway, Address(0x1000));
+    IRFragment *exit  = createFragment(&prog, &proc, FragType::Ret, Address(0x1001));
+    proc.setEntryFragment();
+
+    std::shared_ptr<const CFGAnalysis> analysis = cfg->getAnalysis();
+    QVERIFY(analysis->isUpToDate(cfg));
+    QVERIFY(!analysis->isReachable(analysis->fragToIdx(exit)));
+
+    // unchanged CFG: the analysis is reused
+    QCOMPARE(cfg->getAnalysis(), analysis);
+
+    // new edge: the analysis is recomputed
+    cfg->addEdge(entry, exit);
+    QVERIFY(!analysis->isUpToDate(cfg));
+
+    std::shared_ptr<const CFGAnalysis> newAnalysis = cfg->getAnalysis();
+    QVERIFY(newAnalysis != analysis);
+    QVERIFY(newAnalysis->isUpToDate(cfg));
+    QVERIFY(newAnalysis->isReachable(newAnalysis->fragToIdx(exit)));
+
+    // the old analysis still describes the old graph
+    QVERIFY(!analysis->isReachable(analysis->fragToIdx(exit)));
+
+    // new fragment: the analysis is recomputed
+    createFragment(&prog, &proc, FragType::Oneway, Address(0x1002));
+    QVERIFY(!newAnalysis->isUpToDate(cfg));
+    QCOMPARE(cfg->getAnalysis()->getNumFragments(), std::size_t(3));
+}
+
+
+QTEST_GUILESS_MAIN(CFGAnalysisTest)
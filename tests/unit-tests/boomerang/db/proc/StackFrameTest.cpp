@@ -0,0 +1,94 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "StackFrameTest.h"
+
+
+#include "boomerang/db/proc/StackFrame.h"
+#include "boomerang/ssl/type/ArrayType.h"
+#include "boomerang/ssl/type/IntegerType.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+void StackFrameTest::testAddVariable()
+{
+    StackFrame frame;
+    QVERIFY(frame.isEmpty());
+
+    frame.addVariable(4, "local0", VoidType::get());
+    QVERIFY(frame.isEmpty()); // no size
+
+    frame.addVariable(4, "local0", IntegerType::get(16));
+    QCOMPARE(frame.getNumVariables(), static_cast<std::size_t>(1));
+
+    // the larger variable is kept
+    frame.addVariable(4, "local1", IntegerType::get(32));
+    frame.addVariable(4, "local2", IntegerType::get(8));
+    QCOMPARE(frame.getNumVariables(), static_cast<std::size_t>(1));
+    QVERIFY(frame.findVariable(4) != nullptr);
+    QCOMPARE(frame.findVariable(4)->name, QString("local1"));
+    QCOMPARE(frame.findVariable(4)->size, 4);
+
+    frame.clear();
+    QVERIFY(frame.isEmpty());
+    QVERIFY(frame.findVariable(4) == nullptr);
+}
+
+
+void StackFrameTest::testFindVariable()
+{
+    StackFrame frame;
+    frame.addVariable(4, "local0", IntegerType::get(32));
+    frame.addVariable(12, "local1", IntegerType::get(16));
+
+    QVERIFY(frame.findVariable(3) == nullptr);
+    QCOMPARE(frame.findVariable(4)->name, QString("local0"));
+    QCOMPARE(frame.findVariable(7)->name, QString("local0"));
+    QVERIFY(frame.findVariable(8) == nullptr);
+    QVERIFY(frame.findVariable(11) == nullptr);
+    QCOMPARE(frame.findVariable(13)->name, QString("local1"));
+    QVERIFY(frame.findVariable(14) == nullptr);
+
+    QVERIFY(frame.findVariable(4, true) == nullptr);
+    QCOMPARE(frame.findVariable(5, true)->name, QString("local0"));
+    QVERIFY(frame.findVariable(12, true) == nullptr);
+}
+
+
+void StackFrameTest::testFindOverlapping()
+{
+    StackFrame frame;
+    frame.addVariable(8, "arr", ArrayType::get(IntegerType::get(32), 4)); // 8..23
+    frame.addVariable(12, "local0", IntegerType::get(16));                // 12..13
+
+    // the variable with the lowest start offset wins
+    QCOMPARE(frame.findVariable(8)->name, QString("arr"));
+    QCOMPARE(frame.findVariable(12)->name, QString("arr"));
+    QCOMPARE(frame.findVariable(13)->name, QString("arr"));
+    QCOMPARE(frame.findVariable(23)->name, QString("arr"));
+    QVERIFY(frame.findVariable(24) == nullptr);
+    QCOMPARE(frame.findVariable(12, true)->name, QString("arr"));
+
+    frame.addVariable(16, "local1", IntegerType::get(64));                // 16..23
+    frame.addVariable(20, "local2", IntegerType::get(64));                // 20..27
+    QCOMPARE(frame.findVariable(24)->name, QString("local2"));
+    QCOMPARE(frame.findVariable(21, true)->name, QString("arr"));
+    QCOMPARE(frame.findVariable(25, true)->name, QString("local2"));
+
+    // a large variable does not hide the variables after it
+    frame.addVariable(0, "big", ArrayType::get(IntegerType::get(32), 64)); // 0..255
+    frame.addVariable(300, "local3", IntegerType::get(32));                // 300..303
+    QCOMPARE(frame.findVariable(24)->name, QString("big"));
+    QVERIFY(frame.findVariable(256) == nullptr);
+    QCOMPARE(frame.findVariable(302, true)->name, QString("local3"));
+    QVERIFY(frame.findVariable(304) == nullptr);
+}
+
+
+QTEST_GUILESS_MAIN(StackFrameTest)
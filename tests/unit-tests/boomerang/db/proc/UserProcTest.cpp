@@ -92,6 +92,49 @@ void UserProcTest::testIsNoReturn()
 }
 
 
+void UserProcTest::testGetStatements()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb1 = prog.getCFG()->createBB(BBType::Fall, createInsns(Address(0x1000), 1));
+    BasicBlock *bb2 = prog.getCFG()->createBB(BBType::Fall, createInsns(Address(0x2000), 1));
+    BasicBlock *bb3 = prog.getCFG()->createBB(BBType::Ret,  createInsns(Address(0x3000), 1));
+
+    {
+        UserProc proc(Address(0x1000), "test", nullptr);
+        QVERIFY(proc.getStatements().empty());
+        QVERIFY(proc.getStatements().snapshot().empty());
+    }
+
+    {
+        UserProc proc(Address(0x1000), "test", nullptr);
+        proc.getCFG()->createFragment(FragType::Fall, createRTLs(Address(0x1000), 2, 2), bb1);
+        proc.getCFG()->createFragment(FragType::Fall, createRTLs(Address(0x2000), 2, 0), bb2); // no statements
+        proc.getCFG()->createFragment(FragType::Ret,  createRTLs(Address(0x3000), 1, 3), bb3);
+
+        StatementList stmts;
+        proc.getStatements(stmts);
+        QCOMPARE(stmts.size(), std::size_t(7));
+
+        // the range must visit the same statements in the same order
+        StatementList::iterator it = stmts.begin();
+        std::size_t numStmts = 0;
+
+        for (const SharedStmt &s : proc.getStatements()) {
+            QVERIFY(it != stmts.end());
+            QVERIFY(s == *it);
+            ++it;
+            ++numStmts;
+        }
+
+        QCOMPARE(numStmts, std::size_t(7));
+
+        const std::vector<SharedStmt> snapshot = proc.getStatements().snapshot();
+        QCOMPARE(snapshot.size(), std::size_t(7));
+        QVERIFY(std::equal(snapshot.begin(), snapshot.end(), stmts.begin()));
+    }
+}
+
+
 void UserProcTest::testRemoveStatement()
 {
     Prog prog("test", nullptr);
@@ -449,6 +492,27 @@ void UserProcTest::testAddLocal()
 }
 
 
+void UserProcTest::testRemoveLocals()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    proc.addLocal(IntegerType::get(32, Sign::Signed), "foo", Location::regOf(REG_X86_EAX));
+    proc.addLocal(IntegerType::get(32, Sign::Signed), "bar", Location::regOf(REG_X86_ECX));
+    proc.mapSymbolTo(Location::regOf(REG_X86_EDX), Location::local("foo", &proc));
+    QVERIFY(proc.getSymbolMap().size() == 3);
+
+    proc.removeLocals({});
+    QVERIFY(proc.getLocals().size() == (size_t)2);
+
+    // all symbols of the local are removed as well
+    proc.removeLocals({ "foo" });
+    QVERIFY(proc.getLocals().size() == (size_t)1);
+    QVERIFY(proc.getLocalType("foo") == nullptr);
+    QVERIFY(proc.getSymbolMap().size() == 1);
+    QCOMPARE(proc.findFirstSymbol(Location::regOf(REG_X86_ECX)), QString("bar"));
+}
+
+
 void UserProcTest::testEnsureExpIsMappedToLocal()
 {
     QVERIFY(m_project.loadBinaryFile(HELLO_X86));
@@ -527,6 +591,33 @@ void UserProcTest::testGetSymbolExp()
     QVERIFY(local2 != nullptr);
     QCOMPARE(local2->toString(), Location::memOf(Binary::get(opPlus,
         Unary::get(opAddrOf, Location::local("local1", &proc)), Const::get(3)))->toString());
+
+    SharedExp spMinus12 = Location::memOf(
+        Binary::get(opMinus,
+                    RefExp::get(Location::regOf(REG_X86_ESP), nullptr),
+                    Const::get(12)));
+
+    SharedExp spMinus13 = Location::memOf(
+        Binary::get(opMinus,
+                    RefExp::get(Location::regOf(REG_X86_ESP), nullptr),
+                    Const::get(13)));
+
+    SharedExp spMinus15 = Location::memOf(
+        Binary::get(opMinus,
+                    RefExp::get(Location::regOf(REG_X86_ESP), nullptr),
+                    Const::get(15)));
+
+    proc.addLocal(IntegerType::get(16, Sign::Signed), "short0", spMinus12);
+
+    SharedExp short0 = proc.getSymbolExp(spMinus13, IntegerType::get(8), true);
+    QCOMPARE(short0->toString(), Location::memOf(Binary::get(opPlus,
+        Unary::get(opAddrOf, Location::local("short0", &proc)), Const::get(1)))->toString());
+
+    // the size of the local changes
+    proc.setLocalType("short0", IntegerType::get(32, Sign::Signed));
+    short0 = proc.getSymbolExp(spMinus15, IntegerType::get(8), true);
+    QCOMPARE(short0->toString(), Location::memOf(Binary::get(opPlus,
+        Unary::get(opAddrOf, Location::local("short0", &proc)), Const::get(3)))->toString());
 }
 
 
@@ -631,6 +722,25 @@ void UserProcTest::testMapSymbolTo()
 }
 
 
+void UserProcTest::testRemoveSymbol()
+{
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    proc.mapSymbolTo(Location::regOf(REG_X86_EAX), Location::local("foo", &proc));
+    proc.mapSymbolTo(Location::regOf(REG_X86_EAX), Location::param("bar", &proc));
+    QVERIFY(proc.getSymbolMap().size() == 2);
+
+    proc.removeSymbol(Location::regOf(REG_X86_ECX));
+    QVERIFY(proc.getSymbolMap().size() == 2);
+
+    proc.removeSymbol(Location::regOf(REG_X86_EAX));
+    QVERIFY(proc.getSymbolMap().size() == 1);
+
+    proc.clearSymbolMap();
+    QVERIFY(proc.getSymbolMap().empty());
+}
+
+
 void UserProcTest::testLookupSym()
 {
     UserProc proc(Address(0x1000), "test", nullptr);
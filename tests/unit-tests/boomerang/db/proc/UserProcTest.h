@@ -19,6 +19,7 @@ class UserProcTest : public BoomerangTestWithPlugins
 
 private slots:
     void testIsNoReturn();
+    void testGetStatements();
     void testRemoveStatement();
     void testInsertAssignAfter();
     void testInsertStatementAfter();
@@ -35,6 +36,7 @@ private slots:
 
     void testCreateLocal();
     void testAddLocal();
+    void testRemoveLocals();
     void testEnsureExpIsMappedToLocal();
     void testGetSymbolExp();
     void testFindLocal();
@@ -43,6 +45,7 @@ private slots:
 
     void testExpFromSymbol();
     void testMapSymbolTo();
+    void testRemoveSymbol();
     void testLookupSym();
     void testLookupSymFromRef();
     void testLookupSymFromRefAny();
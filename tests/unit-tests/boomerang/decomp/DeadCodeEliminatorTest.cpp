@@ -0,0 +1,111 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DeadCodeEliminatorTest.h"
+
+
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/decomp/DeadCodeEliminator.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+#include <algorithm>
+
+
+static std::shared_ptr<Assign> createAssign(const SharedExp &lhs, const SharedExp &rhs)
+{
+    return std::make_shared<Assign>(VoidType::get(), lhs, rhs);
+}
+
+
+static bool contains(const std::vector<SharedStmt> &stmts, const SharedStmt &stmt)
+{
+    return std::find(stmts.begin(), stmts.end(), stmt) != stmts.end();
+}
+
+
+void DeadCodeEliminatorTest::testMarkChain()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb = prog.getCFG()->createBB(BBType::Oneway, createInsns(Address(0x1000), 1));
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    // 1: eax := ecx                live (used by 2)
+    // 2: edx := eax{1}             live (root)
+    // 3: ebx := 5                  dead (only used by 4)
+    // 4: esi := ebx{3}             dead
+    std::shared_ptr<Assign> a1 = createAssign(Location::regOf(REG_X86_EAX),
+                                              Location::regOf(REG_X86_ECX));
+    std::shared_ptr<Assign> a2 = createAssign(Location::regOf(REG_X86_EDX),
+                                              RefExp::get(Location::regOf(REG_X86_EAX), a1));
+    std::shared_ptr<Assign> a3 = createAssign(Location::regOf(REG_X86_EBX), Const::get(5));
+    std::shared_ptr<Assign> a4 = createAssign(Location::regOf(REG_X86_ESI),
+                                              RefExp::get(Location::regOf(REG_X86_EBX), a3));
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, a2, a3, a4 })));
+    IRFragment *frag = proc.getCFG()->createFragment(FragType::Oneway, std::move(rtls), bb);
+
+    for (const SharedStmt &s : { a1, a2, a3, a4 }) {
+        s->setFragment(frag);
+    }
+
+    DeadCodeEliminator dce(&proc);
+    const std::size_t numDead = dce.mark([](const SharedStmt &s) {
+        return *s->as<Assign>()->getLeft() != *Location::regOf(REG_X86_EDX);
+    });
+
+    QCOMPARE(numDead, std::size_t(2));
+    QVERIFY(!contains(dce.getDeadStatements(), a1));
+    QVERIFY(!contains(dce.getDeadStatements(), a2));
+    QVERIFY(contains(dce.getDeadStatements(), a3));
+    QVERIFY(contains(dce.getDeadStatements(), a4));
+}
+
+
+void DeadCodeEliminatorTest::testMarkDeadCycle()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb = prog.getCFG()->createBB(BBType::Oneway, createInsns(Address(0x1000), 1));
+    UserProc proc(Address(0x1000), "test", nullptr);
+
+    // 1: eax := eax{2} + 1         kept (used by 2)
+    // 2: eax := eax{1} + 1         kept (used by 1)
+    std::shared_ptr<Assign> a1 = createAssign(Location::regOf(REG_X86_EAX), Const::get(0));
+    std::shared_ptr<Assign> a2 = createAssign(
+        Location::regOf(REG_X86_EAX),
+        Binary::get(opPlus, RefExp::get(Location::regOf(REG_X86_EAX), a1), Const::get(1)));
+    a1->setRight(Binary::get(opPlus, RefExp::get(Location::regOf(REG_X86_EAX), a2), Const::get(1)));
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { a1, a2 })));
+    IRFragment *frag = proc.getCFG()->createFragment(FragType::Oneway, std::move(rtls), bb);
+
+    for (const SharedStmt &s : { a1, a2 }) {
+        s->setFragment(frag);
+    }
+
+    // Dead cycles are not removed
+    DeadCodeEliminator dce(&proc);
+    QCOMPARE(dce.mark([](const SharedStmt &) { return true; }), std::size_t(0));
+
+    // Break the reference cycle so the statements can be freed
+    a1->setRight(Const::get(0));
+}
+
+
+QTEST_GUILESS_MAIN(DeadCodeEliminatorTest)
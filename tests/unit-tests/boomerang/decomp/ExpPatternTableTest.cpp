@@ -0,0 +1,127 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "ExpPatternTableTest.h"
+
+
+#include "boomerang/decomp/ExpPatternTable.h"
+#include "boomerang/decomp/IndirectJumpAnalyzer.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/exp/Terminal.h"
+
+
+/// \returns the index of the first pattern that matches \p e, trying all patterns in order.
+static int linearMatch(const std::vector<SharedConstExp> &patterns, const SharedConstExp &e)
+{
+    for (int i = 0; i < static_cast<int>(patterns.size()); ++i) {
+        if (e->equalNoSubscript(*patterns[i])) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+/// Expressions that match some of the switch and call patterns, or almost match them.
+static std::vector<SharedConstExp> createExpressions()
+{
+    const SharedExp eax      = Location::regOf(REG_X86_EAX);
+    const SharedExp eaxTimes4 = Binary::get(opMult, eax, Const::get(4));
+
+    return {
+        Const::get(5),
+        eax,
+        RefExp::get(eax->clone(), nullptr),
+        Terminal::get(opWild),
+        Binary::get(opPlus, eax->clone(), Const::get(4)),
+
+        // switch forms
+        RefExp::get(Binary::get(opArrayIndex,
+                                RefExp::get(Location::global("table", nullptr), nullptr),
+                                eax->clone()),
+                    nullptr),
+        Location::memOf(Binary::get(opPlus, eaxTimes4->clone(), Const::get(0x1000))),
+        RefExp::get(Location::memOf(Binary::get(opPlus,
+                                                Binary::get(opMult,
+                                                            RefExp::get(eax->clone(), nullptr),
+                                                            Const::get(4)),
+                                                Const::get(0x1000))),
+                    nullptr),
+        Binary::get(opPlus, Location::memOf(Binary::get(opPlus, eaxTimes4->clone(),
+                                                        Const::get(0x1000))),
+                    Const::get(0x2000)),
+        Binary::get(opPlus, Terminal::get(opPC),
+                    Location::memOf(Binary::get(opPlus, Terminal::get(opPC),
+                                                Binary::get(opPlus, eaxTimes4->clone(),
+                                                            Const::get(28))))),
+        Binary::get(opPlus, Terminal::get(opPC),
+                    Location::memOf(Binary::get(opPlus, Terminal::get(opPC),
+                                                Binary::get(opMinus, eaxTimes4->clone(),
+                                                            Const::get(288))))),
+        Location::memOf(Binary::get(opPlus, Binary::get(opMult, eax->clone(), Const::get(8)),
+                                    Const::get(0x1000))),
+        Location::memOf(Binary::get(opPlus, eaxTimes4->clone(), Location::regOf(REG_X86_EBX))),
+
+        // call patterns
+        Binary::get(opArrayIndex, Location::global("funcptr", nullptr), Const::get(0)),
+        Binary::get(opArrayIndex, Location::global("funcptr", nullptr), Const::get(1)),
+        Location::memOf(Binary::get(opPlus,
+                                    Location::memOf(Binary::get(opPlus, eax->clone(),
+                                                                Const::get(8))),
+                                    Const::get(4))),
+        Location::memOf(Binary::get(opPlus, Location::memOf(eax->clone()), Const::get(4))),
+        Location::memOf(Location::memOf(Binary::get(opPlus, eax->clone(), Const::get(8)))),
+        Location::memOf(Location::memOf(RefExp::get(eax->clone(), nullptr))),
+        Location::memOf(eax->clone()),
+        Location::memOf(Const::get(0x1000)),
+        Binary::get(opPlus, Location::memOf(eax->clone()), Const::get(4)),
+    };
+}
+
+
+void ExpPatternTableTest::testSwitchPatterns()
+{
+    const std::vector<SharedConstExp> patterns = IndirectJumpAnalyzer::getSwitchPatterns();
+    const ExpPatternTable table(patterns);
+
+    for (const SharedConstExp &e : createExpressions()) {
+        QCOMPARE(table.match(e), linearMatch(patterns, e));
+    }
+
+    // m[eax * 4 + 0x1000] is form A
+    const SharedConstExp formA = Location::memOf(
+        Binary::get(opPlus, Binary::get(opMult, Location::regOf(REG_X86_EAX), Const::get(4)),
+                    Const::get(0x1000)));
+
+    QCOMPARE(table.match(formA), 1);
+}
+
+
+void ExpPatternTableTest::testCallPatterns()
+{
+    const std::vector<SharedConstExp> patterns = IndirectJumpAnalyzer::getCallPatterns();
+    const ExpPatternTable table(patterns);
+
+    for (const SharedConstExp &e : createExpressions()) {
+        QCOMPARE(table.match(e), linearMatch(patterns, e));
+    }
+
+    // m[m[eax] + 4] is a virtual call without vtable offset
+    const SharedConstExp vto = Location::memOf(
+        Binary::get(opPlus, Location::memOf(Location::regOf(REG_X86_EAX)), Const::get(4)));
+
+    QCOMPARE(table.match(vto), 2);
+}
+
+
+QTEST_GUILESS_MAIN(ExpPatternTableTest)
@@ -0,0 +1,164 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "AssignRemovalPassTest.h"
+
+
+#include "boomerang/core/Settings.h"
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/passes/PassManager.h"
+#include "boomerang/ssl/RTL.h"
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/ssl/exp/Location.h"
+#include "boomerang/ssl/exp/RefExp.h"
+#include "boomerang/ssl/statements/Assign.h"
+#include "boomerang/ssl/type/VoidType.h"
+
+
+#define SAMPLE(path) (m_project.getSettings()->getDataDirectory().absoluteFilePath("samples/" path))
+#define HELLO_X86    SAMPLE("x86/hello")
+
+
+static std::shared_ptr<Assign> createAssign(const SharedExp &lhs, const SharedExp &rhs)
+{
+    return std::make_shared<Assign>(VoidType::get(), lhs, rhs);
+}
+
+
+/// Put \p stmts into a single fragment of \p proc.
+static void addStatements(UserProc *proc, const std::initializer_list<SharedStmt> &stmts)
+{
+    BasicBlock *bb = proc->getProg()->getCFG()->createBB(BBType::Oneway,
+                                                         createInsns(Address(0x1000), 1));
+
+    std::unique_ptr<RTLList> rtls(new RTLList);
+    rtls->push_back(std::unique_ptr<RTL>(new RTL(bb->getLowAddr(), stmts)));
+    IRFragment *frag = proc->getCFG()->createFragment(FragType::Oneway, std::move(rtls), bb);
+
+    for (const SharedStmt &s : stmts) {
+        s->setFragment(frag);
+        s->setProc(proc);
+    }
+}
+
+
+UserProc *AssignRemovalPassTest::createProc()
+{
+    if (!m_project.loadBinaryFile(HELLO_X86)) {
+        return nullptr;
+    }
+
+    Function *proc = m_project.getProg()->getOrCreateFunction(Address(0x08048328));
+    return (proc && !proc->isLib()) ? static_cast<UserProc *>(proc) : nullptr;
+}
+
+
+void AssignRemovalPassTest::testUsedSp()
+{
+    UserProc *proc = createProc();
+    QVERIFY(proc != nullptr);
+
+    const SharedExp esp = Location::regOf(REG_X86_ESP);
+
+    // 1: esp := esp{-} - 4          used by 3
+    // 2: esp := esp{1} - 4          not used, but kept since sp is used
+    // 3: eax := m[esp{1}]
+    std::shared_ptr<Assign> a1 = createAssign(
+        esp->clone(), Binary::get(opMinus, RefExp::get(esp->clone(), nullptr), Const::get(4)));
+    std::shared_ptr<Assign> a2 = createAssign(
+        esp->clone(), Binary::get(opMinus, RefExp::get(esp->clone(), a1), Const::get(4)));
+    std::shared_ptr<Assign> a3 = createAssign(Location::regOf(REG_X86_EAX),
+                                              Location::memOf(RefExp::get(esp->clone(), a1)));
+
+    addStatements(proc, { a1, a2, a3 });
+
+    QVERIFY(!PassManager::get()->executePass(PassID::AssignRemoval, proc));
+    QCOMPARE(proc->getStatements().snapshot().size(), std::size_t(3));
+}
+
+
+void AssignRemovalPassTest::testUnusedSp()
+{
+    UserProc *proc = createProc();
+    QVERIFY(proc != nullptr);
+
+    const SharedExp esp = Location::regOf(REG_X86_ESP);
+
+    // 1: esp := esp{-} - 4          removed
+    // 2: esp := 0                   removed
+    // 3: eax := m[esp{-}]           kept
+    std::shared_ptr<Assign> a1 = createAssign(
+        esp->clone(), Binary::get(opMinus, RefExp::get(esp->clone(), nullptr), Const::get(4)));
+    std::shared_ptr<Assign> a2 = createAssign(esp->clone(), Const::get(0));
+    std::shared_ptr<Assign> a3 = createAssign(Location::regOf(REG_X86_EAX),
+                                              Location::memOf(RefExp::get(esp->clone(), nullptr)));
+
+    addStatements(proc, { a1, a2, a3 });
+
+    QVERIFY(PassManager::get()->executePass(PassID::AssignRemoval, proc));
+
+    const std::vector<SharedStmt> remaining = proc->getStatements().snapshot();
+    QCOMPARE(remaining.size(), std::size_t(1));
+    QVERIFY(remaining[0] == a3);
+}
+
+
+void AssignRemovalPassTest::testUsedTemp()
+{
+    UserProc *proc = createProc();
+    QVERIFY(proc != nullptr);
+
+    const SharedExp tmp1 = Location::tempOf(Const::get("tmp1"));
+    const SharedExp tmp2 = Location::tempOf(Const::get("tmp2"));
+
+    // 1: tmp1 := 5                  used by 3
+    // 2: tmp2 := 6                  not used, but kept since tmp1 is used
+    // 3: eax := tmp1{1}
+    std::shared_ptr<Assign> a1 = createAssign(tmp1->clone(), Const::get(5));
+    std::shared_ptr<Assign> a2 = createAssign(tmp2->clone(), Const::get(6));
+    std::shared_ptr<Assign> a3 = createAssign(Location::regOf(REG_X86_EAX),
+                                              RefExp::get(tmp1->clone(), a1));
+
+    addStatements(proc, { a1, a2, a3 });
+
+    QVERIFY(!PassManager::get()->executePass(PassID::AssignRemoval, proc));
+    QCOMPARE(proc->getStatements().snapshot().size(), std::size_t(3));
+}
+
+
+void AssignRemovalPassTest::testUnusedTemp()
+{
+    UserProc *proc = createProc();
+    QVERIFY(proc != nullptr);
+
+    const SharedExp esp  = Location::regOf(REG_X86_ESP);
+    const SharedExp tmp1 = Location::tempOf(Const::get("tmp1"));
+
+    // 1: tmp1 := 5                  removed (only used by 2, which is removed)
+    // 2: esp := tmp1{1}             removed (sp is not used)
+    // 3: eax := 7                   kept
+    std::shared_ptr<Assign> a1 = createAssign(tmp1->clone(), Const::get(5));
+    std::shared_ptr<Assign> a2 = createAssign(esp->clone(), RefExp::get(tmp1->clone(), a1));
+    std::shared_ptr<Assign> a3 = createAssign(Location::regOf(REG_X86_EAX), Const::get(7));
+
+    addStatements(proc, { a1, a2, a3 });
+
+    QVERIFY(PassManager::get()->executePass(PassID::AssignRemoval, proc));
+
+    const std::vector<SharedStmt> remaining = proc->getStatements().snapshot();
+    QCOMPARE(remaining.size(), std::size_t(1));
+    QVERIFY(remaining[0] == a3);
+}
+
+
+QTEST_GUILESS_MAIN(AssignRemovalPassTest)
@@ -0,0 +1,34 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include "TestUtils.h"
+
+
+class UserProc;
+
+
+class AssignRemovalPassTest : public BoomerangTestWithPlugins
+{
+    Q_OBJECT
+
+private slots:
+    /// All assignments to sp are kept if any sp definition is used
+    void testUsedSp();
+    void testUnusedSp();
+
+    /// All assignments to temporaries are kept if any temporary is used
+    void testUsedTemp();
+    void testUnusedTemp();
+
+private:
+    UserProc *createProc();
+};
@@ -238,7 +238,34 @@ void CallStatementTest::testSearchAll()
 
 void CallStatementTest::testSearchAndReplace()
 {
-    QSKIP("TODO");
+    const SharedExp eax = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx = Location::regOf(REG_X86_ECX);
+    const SharedExp edx = Location::regOf(REG_X86_EDX);
+    const SharedExp esi = Location::regOf(REG_X86_ESI);
+
+    std::shared_ptr<CallStatement> call(new CallStatement(Address(0x1000)));
+    DefCollector *defCol = call->getDefCollector();
+
+    defCol->collectDef(std::make_shared<Assign>(Location::memOf(RefExp::get(eax, nullptr)),
+                                                Const::get(1)));
+    defCol->collectDef(std::make_shared<Assign>(Location::memOf(RefExp::get(ecx, nullptr)),
+                                                Const::get(2)));
+    defCol->collectDef(std::make_shared<Assign>(Location::memOf(RefExp::get(edx, nullptr)),
+                                                Const::get(3)));
+
+    // Collected definitions are only changed if cc is true
+    QVERIFY(!call->searchAndReplace(*RefExp::get(eax, nullptr), RefExp::get(esi, nullptr), false));
+    QVERIFY(call->findDefFor(Location::memOf(RefExp::get(eax, nullptr))) != nullptr);
+
+    // m[eax{-}] -> m[esi{-}] now sorts after m[edx{-}]
+    QVERIFY(call->searchAndReplace(*RefExp::get(eax, nullptr), RefExp::get(esi, nullptr), true));
+    QVERIFY(call->findDefFor(Location::memOf(RefExp::get(eax, nullptr))) == nullptr);
+
+    const SharedExp memEsi = Location::memOf(RefExp::get(esi, nullptr));
+    QVERIFY(call->findDefFor(memEsi) != nullptr);
+    QCOMPARE(*call->findDefFor(memEsi), *Const::get(1));
+    QVERIFY(call->findDefFor(Location::memOf(RefExp::get(ecx, nullptr))) != nullptr);
+    QVERIFY(call->findDefFor(Location::memOf(RefExp::get(edx, nullptr))) != nullptr);
 }
 
 
@@ -505,7 +532,40 @@ void CallStatementTest::testSetSigArguments()
 
 void CallStatementTest::testUpdateArguments()
 {
-    QSKIP("TODO");
+    const SharedExp eax = Location::regOf(REG_X86_EAX);
+    const SharedExp ecx = Location::regOf(REG_X86_ECX);
+    const SharedExp edx = Location::regOf(REG_X86_EDX);
+
+    Prog prog("test", &m_project);
+    UserProc *srcProc = static_cast<UserProc *>(prog.getOrCreateFunction(Address(0x1000)));
+
+    // no destination: the arguments are taken from the def collector
+    std::shared_ptr<CallStatement> call(new CallStatement(Address(0x2000)));
+    call->setProc(srcProc);
+    call->getDefCollector()->collectDef(std::make_shared<Assign>(ecx, eax));
+
+    call->updateArguments();
+    QCOMPARE(call->getNumArguments(), 1);
+    QCOMPARE(call->getArguments().toString(), "   0 *v* r25 := r24");
+
+    // existing arguments are not added again
+    call->updateArguments();
+    QCOMPARE(call->getNumArguments(), 1);
+    QCOMPARE(call->getArguments().toString(), "   0 *v* r25 := r24");
+
+    call->getDefCollector()->collectDef(std::make_shared<Assign>(edx, eax));
+    call->updateArguments();
+    QCOMPARE(call->getNumArguments(), 2);
+    QVERIFY(call->getArguments().existsOnLeft(ecx));
+    QVERIFY(call->getArguments().existsOnLeft(edx));
+
+    // arguments that are no longer defined are removed
+    call->getDefCollector()->clear();
+    call->getDefCollector()->collectDef(std::make_shared<Assign>(edx, eax));
+    call->updateArguments();
+    QCOMPARE(call->getNumArguments(), 1);
+    QVERIFY(!call->getArguments().existsOnLeft(ecx));
+    QVERIFY(call->getArguments().existsOnLeft(edx));
 }
 
 
@@ -10,9 +10,15 @@
 #include "PhiAssignTest.h"
 
 
+#include "boomerang/db/LowLevelCFG.h"
+#include "boomerang/db/Prog.h"
+#include "boomerang/db/proc/ProcCFG.h"
+#include "boomerang/db/proc/UserProc.h"
+#include "boomerang/ssl/RTL.h"
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/exp/Ternary.h"
+#include "boomerang/ssl/statements/Assign.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/util/LocationSet.h"
@@ -134,4 +140,43 @@ void PhiAssignTest::testSearchAndReplace()
 }
 
 
+void PhiAssignTest::testPutAt()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb = prog.getCFG()->createBB(BBType::Fall, createInsns(Address(0x1000), 1));
+
+    UserProc proc(Address(0x1000), "test", nullptr);
+    IRFragment *frag1 = proc.getCFG()->createFragment(FragType::Fall, createRTLs(Address(0x1000), 1, 0), bb);
+    IRFragment *frag2 = proc.getCFG()->createFragment(FragType::Fall, createRTLs(Address(0x1001), 1, 0), bb);
+    IRFragment *frag3 = proc.getCFG()->createFragment(FragType::Fall, createRTLs(Address(0x1002), 1, 0), bb);
+
+    std::shared_ptr<Assign> def1(new Assign(Location::regOf(REG_X86_EAX), Const::get(1)));
+    std::shared_ptr<Assign> def2(new Assign(Location::regOf(REG_X86_EAX), Const::get(2)));
+    std::shared_ptr<Assign> def3(new Assign(Location::regOf(REG_X86_EAX), Const::get(3)));
+
+    std::shared_ptr<PhiAssign> phi(new PhiAssign(Location::regOf(REG_X86_EAX)));
+    phi->putAt(frag3, def3, Location::regOf(REG_X86_EAX));
+    phi->putAt(frag1, nullptr, Location::regOf(REG_X86_EAX));
+    phi->putAt(frag2, def2, Location::regOf(REG_X86_EAX));
+    phi->putAt(frag1, def1, Location::regOf(REG_X86_EAX)); // replaces the first operand
+
+    // operands are ordered by fragment, independent of insertion order
+    QCOMPARE(phi->getNumDefs(), size_t(3));
+    QVERIFY(phi->getDefs()[0].first == frag1);
+    QVERIFY(phi->getDefs()[1].first == frag2);
+    QVERIFY(phi->getDefs()[2].first == frag3);
+
+    QVERIFY(phi->getStmtAt(frag1) == def1);
+    QVERIFY(phi->getStmtAt(frag2) == def2);
+    QVERIFY(phi->getStmtAt(frag3) == def3);
+    QVERIFY(phi->getStmtAt(nullptr) == nullptr);
+
+    // remove the operand defined by def2
+    phi->removeAllReferences(RefExp::get(Location::regOf(REG_X86_EAX), def2));
+    QCOMPARE(phi->getNumDefs(), size_t(2));
+    QVERIFY(phi->getStmtAt(frag2) == nullptr);
+    QVERIFY(phi->getStmtAt(frag3) == def3);
+}
+
+
 QTEST_GUILESS_MAIN(PhiAssignTest)
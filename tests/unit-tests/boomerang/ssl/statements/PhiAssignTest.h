@@ -24,4 +24,5 @@ private slots:
     void testSearch();
     void testSearchAll();
     void testSearchAndReplace();
+    void testPutAt();
 };
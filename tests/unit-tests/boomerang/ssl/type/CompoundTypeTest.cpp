@@ -188,6 +188,44 @@ void CompoundTypeTest::testMemberOffset()
 }
 
 
+void CompoundTypeTest::testMemberOffsetAfterResize()
+{
+    std::shared_ptr<ArrayType> arr = ArrayType::get(IntegerType::get(8), 4);
+
+    CompoundType ct1;
+    ct1.addMember(arr, "buf");
+    ct1.addMember(FloatType::get(32), "foo");
+
+    QCOMPARE(ct1.getMemberOffsetByName("foo"), 32);
+    QCOMPARE(ct1.getMemberNameByOffset(40), QString("foo"));
+
+    // resizing a member type changes the offsets of all following members
+    arr->setLength(8);
+    QCOMPARE(ct1.getMemberOffsetByName("foo"), 64);
+    QCOMPARE(ct1.getMemberNameByOffset(40), QString("buf"));
+    QCOMPARE(ct1.getSize(), 96);
+
+    ct1.setMemberTypeByOffset(0, IntegerType::get(32));
+    QCOMPARE(ct1.getNumMembers(), 3);
+    QCOMPARE(ct1.getMemberNameByOffset(40), QString("pad"));
+    QCOMPARE(ct1.getMemberOffsetByName("foo"), 64);
+
+    // resizing a member of a union member changes the size of the union
+    std::shared_ptr<IntegerType> unionMember = IntegerType::get(16);
+    ct1.addMember(UnionType::get({ unionMember, IntegerType::get(8) }), "u");
+    QCOMPARE(ct1.getSize(), 112);
+
+    unionMember->setSize(64);
+    QCOMPARE(ct1.getSize(), 160);
+
+    // types that are not part of a compound type do not invalidate any layout
+    const uint64 version = Type::getLayoutVersion();
+    IntegerType::get(32)->setSize(64);
+    ArrayType::get(IntegerType::get(8), 4)->setLength(8);
+    QCOMPARE(Type::getLayoutVersion(), version);
+}
+
+
 void CompoundTypeTest::testGetOffsetRemainder()
 {
     QCOMPARE(CompoundType().getOffsetRemainder(0), 0);
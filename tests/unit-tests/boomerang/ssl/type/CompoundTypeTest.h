@@ -26,6 +26,7 @@ private slots:
     void testMemberType();
     void testMemberName();
     void testMemberOffset();
+    void testMemberOffsetAfterResize();
     void testGetOffsetRemainder();
     void testIsCompatibleWith();
 };
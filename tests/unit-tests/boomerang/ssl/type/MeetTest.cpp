@@ -430,4 +430,38 @@ void MeetTest::testMeet_data()
         UnionType::get({ IntegerType::get(32, Sign::Signed), FloatType::get(32), PointerType::get(VoidType::get()) }));
 }
 
+
+void MeetTest::testMeetNoCopy()
+{
+    bool changed = false;
+
+    QVERIFY(VoidType::get() == VoidType::get());
+    QVERIFY(CharType::get()->clone() == CharType::get());
+
+    SharedType i32 = IntegerType::get(32, Sign::Unknown);
+    QVERIFY(i32->meetWith(IntegerType::get(16, Sign::Unknown), changed) == i32);
+    QVERIFY(i32->meetWith(SizeType::get(32), changed) == i32);
+    QVERIFY(!changed);
+
+    SharedType s32 = SizeType::get(32);
+    QVERIFY(s32->meetWith(SizeType::get(16), changed) == s32);
+    QVERIFY(VoidType::get()->meetWith(CharType::get(), changed) == CharType::get());
+    QVERIFY(changed);
+
+    // void meet x must not share mutable types with x
+    changed = false;
+    SharedType voidMeet = VoidType::get()->meetWith(i32, changed);
+    QVERIFY(voidMeet != i32);
+    QVERIFY(*voidMeet == *i32);
+    QVERIFY(changed);
+
+    // sign changes require a new type
+    changed = false;
+    SharedType result = i32->meetWith(IntegerType::get(32, Sign::Signed), changed);
+    QVERIFY(result != i32);
+    QVERIFY(changed);
+    QVERIFY(i32->as<IntegerType>()->isSignUnknown());
+}
+
+
 QTEST_GUILESS_MAIN(MeetTest)
@@ -24,4 +24,7 @@ private slots:
     /// Test meeting IntegerTypes with various other types
     void testMeet();
     void testMeet_data();
+
+    /// Test that meet does not create new types if the result is equal to an operand
+    void testMeetNoCopy();
 };
@@ -52,6 +52,20 @@ void UnionTest::testConstruct()
 }
 
 
+void UnionTest::testClone()
+{
+    std::shared_ptr<UnionType> u1 = UnionType::get(
+        { { IntegerType::get(32, Sign::Signed), "a" }, { FloatType::get(64), "b" } });
+
+    SharedType u2 = u1->clone();
+    QVERIFY(u2 != u1);
+    QVERIFY(*u2 == *u1);
+    QCOMPARE(u2->getCtype(), u1->getCtype());
+    QVERIFY(u2->as<UnionType>()->hasType(FloatType::get(64)));
+    QVERIFY(!u2->as<UnionType>()->hasType(FloatType::get(32)));
+}
+
+
 void UnionTest::testCompare()
 {
     // equality comparison
@@ -173,6 +187,35 @@ void UnionTest::testHasType()
     QVERIFY(!u2.hasType(VoidType::get()));
     QVERIFY(!u2.hasType(FloatType::get(32)));
     QVERIFY(u2.hasType(IntegerType::get(32, Sign::Signed)));
+
+    UnionType u3{ FloatType::get(64), PointerType::get(FloatType::get(32)),
+                  IntegerType::get(16, Sign::Unsigned) };
+    QVERIFY(u3.hasType(FloatType::get(64)));
+    QVERIFY(!u3.hasType(FloatType::get(32)));
+    QVERIFY(u3.hasType(PointerType::get(FloatType::get(32))));
+    QVERIFY(!u3.hasType(PointerType::get(FloatType::get(64))));
+    QVERIFY(u3.hasType(IntegerType::get(16, Sign::Unsigned)));
+    QVERIFY(!u3.hasType(IntegerType::get(32, Sign::Unsigned)));
+
+    // member order does not depend on insertion order
+    UnionType u4{ IntegerType::get(16, Sign::Unsigned), PointerType::get(FloatType::get(32)),
+                  FloatType::get(64) };
+    QVERIFY(u3 == u4);
+    QCOMPARE(u3.getCtype(), u4.getCtype());
+
+    // compound types with the same number of members have the same hash
+    std::shared_ptr<CompoundType> c1 = CompoundType::get();
+    c1->addMember(IntegerType::get(32, Sign::Signed), "x");
+    std::shared_ptr<CompoundType> c2 = CompoundType::get();
+    c2->addMember(FloatType::get(32), "y");
+    std::shared_ptr<CompoundType> c3 = CompoundType::get();
+    c3->addMember(FloatType::get(64), "z");
+
+    UnionType u5{ c1, c2 };
+    QCOMPARE(u5.getNumTypes(), 2);
+    QVERIFY(u5.hasType(c1));
+    QVERIFY(u5.hasType(c2));
+    QVERIFY(!u5.hasType(c3));
 }
 
 
@@ -18,6 +18,7 @@ class UnionTest : public BoomerangTest
 
 private slots:
     void testConstruct();
+    void testClone();
     void testCompare(); // operator==, operator<
     void testGetSize();
     void testGetCtype();
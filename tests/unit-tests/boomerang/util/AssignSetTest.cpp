@@ -198,6 +198,21 @@ void AssignSetTest::testLookupLoc()
     QVERIFY(set1.lookupLoc(nullptr) == nullptr);
     QCOMPARE(set1.lookupLoc(Location::regOf(REG_X86_ECX)), assign1);
     QVERIFY(set1.lookupLoc(Location::regOf(REG_X86_EAX)) == nullptr);
+
+    std::shared_ptr<Assign> assign2(new Assign(Location::memOf(Location::regOf(REG_X86_ESP)), Location::regOf(REG_X86_ECX)));
+    std::shared_ptr<Assign> assign3(new Assign(Location::regOf(REG_X86_EDX), Location::regOf(REG_X86_EAX)));
+    set1.insert(assign2);
+    set1.insert(assign3);
+
+    QCOMPARE(set1.lookupLoc(Location::regOf(REG_X86_ECX)), assign1);
+    QCOMPARE(set1.lookupLoc(Location::memOf(Location::regOf(REG_X86_ESP))), assign2);
+    QCOMPARE(set1.lookupLoc(Location::regOf(REG_X86_EDX)), assign3);
+    QVERIFY(set1.lookupLoc(Location::regOf(REG_X86_ESP)) == nullptr);
+    QVERIFY(set1.lookupLoc(Location::memOf(Location::regOf(REG_X86_EAX))) == nullptr);
+
+    set1.remove(assign1);
+    QVERIFY(set1.lookupLoc(Location::regOf(REG_X86_ECX)) == nullptr);
+    QCOMPARE(set1.lookupLoc(Location::regOf(REG_X86_EDX)), assign3);
 }
 
 
@@ -0,0 +1,99 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "DecompilationScopeTest.h"
+
+
+#include "boomerang/util/DecompilationScope.h"
+
+
+void DecompilationScopeTest::testIsUnrestricted()
+{
+    DecompilationScope scope;
+    QVERIFY(scope.isUnrestricted());
+    QVERIFY(!scope.hasRootFilter());
+
+    scope.setMaxCalleeDepth(2);
+    QVERIFY(!scope.isUnrestricted());
+    QVERIFY(!scope.hasRootFilter());
+
+    scope.setMaxCalleeDepth(DecompilationScope::UNLIMITED_DEPTH);
+    QVERIFY(scope.isUnrestricted());
+
+    scope.addNamePattern("main");
+    QVERIFY(!scope.isUnrestricted());
+    QVERIFY(scope.hasRootFilter());
+}
+
+
+void DecompilationScopeTest::testAddressRange()
+{
+    DecompilationScope scope;
+
+    // empty ranges are ignored
+    scope.addAddressRange(Address(0x1000), Address(0x1000));
+    QVERIFY(!scope.hasRootFilter());
+
+    scope.addAddressRange(Address(0x1000), Address(0x2000));
+    QVERIFY(scope.hasRootFilter());
+
+    QVERIFY(!scope.isRoot(Address(0x0FFF), "foo"));
+    QVERIFY(scope.isRoot(Address(0x1000), "foo"));
+    QVERIFY(scope.isRoot(Address(0x1FFF), ""));
+    QVERIFY(!scope.isRoot(Address(0x2000), "foo"));
+}
+
+
+void DecompilationScopeTest::testNamePattern()
+{
+    DecompilationScope scope;
+    scope.addNamePattern("crypt_*");
+    scope.addNamePattern("main");
+
+    QVERIFY(scope.isRoot(Address(0x1000), "crypt_init"));
+    QVERIFY(scope.isRoot(Address(0x1000), "crypt_"));
+    QVERIFY(scope.isRoot(Address(0x1000), "main"));
+    QVERIFY(!scope.isRoot(Address(0x1000), "decrypt_init"));
+    QVERIFY(!scope.isRoot(Address(0x1000), "main2"));
+    QVERIFY(!scope.isRoot(Address(0x1000), ""));
+
+    DecompilationScope scope2;
+    scope2.addNamePattern("sub_?[0-9]");
+    scope2.addNamePattern("a.b");
+    scope2.addNamePattern("init[!0-9]");
+
+    QVERIFY(scope2.isRoot(Address(0x1000), "sub_x1"));
+    QVERIFY(!scope2.isRoot(Address(0x1000), "sub_xy"));
+    QVERIFY(!scope2.isRoot(Address(0x1000), "sub_1"));
+    QVERIFY(scope2.isRoot(Address(0x1000), "a.b"));
+    QVERIFY(!scope2.isRoot(Address(0x1000), "axb"));
+    QVERIFY(scope2.isRoot(Address(0x1000), "initx"));
+    QVERIFY(!scope2.isRoot(Address(0x1000), "init1"));
+    QVERIFY(!scope2.isRoot(Address(0x1000), "init"));
+}
+
+
+void DecompilationScopeTest::testDepth()
+{
+    DecompilationScope scope;
+    QVERIFY(scope.isDepthInScope(0));
+    QVERIFY(scope.isDepthInScope(100));
+
+    scope.setMaxCalleeDepth(0);
+    QVERIFY(scope.isDepthInScope(0));
+    QVERIFY(!scope.isDepthInScope(1));
+
+    scope.setMaxCalleeDepth(2);
+    QCOMPARE(scope.getMaxCalleeDepth(), 2);
+    QVERIFY(scope.isDepthInScope(2));
+    QVERIFY(!scope.isDepthInScope(3));
+}
+
+
+QTEST_GUILESS_MAIN(DecompilationScopeTest)
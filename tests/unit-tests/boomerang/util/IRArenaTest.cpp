@@ -0,0 +1,137 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "IRArenaTest.h"
+
+
+#include "boomerang/ssl/exp/Binary.h"
+#include "boomerang/ssl/exp/Const.h"
+#include "boomerang/util/IRArena.h"
+
+#include <thread>
+
+
+void IRArenaTest::testAllocate()
+{
+    IRArena *arena = new IRArena;
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(0));
+    QCOMPARE(arena->getReservedBytes(), std::size_t(0));
+
+    void *p1 = arena->allocate(24);
+    void *p2 = arena->allocate(24);
+    QVERIFY(p1 != nullptr);
+    QVERIFY(p2 != nullptr);
+    QVERIFY(p1 != p2);
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(2));
+    QVERIFY(arena->getReservedBytes() > 0);
+
+    // freed memory is reused for allocations of the same size class
+    arena->deallocate(p1, 24);
+    void *p3 = arena->allocate(20);
+    QVERIFY(p3 == p1);
+
+    // large allocations are served by the heap
+    void *big = arena->allocate(4096);
+    QVERIFY(big != nullptr);
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(3));
+
+    arena->deallocate(big, 4096);
+    arena->deallocate(p2, 24);
+    arena->deallocate(p3, 20);
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(0));
+
+    arena->release();
+}
+
+
+void IRArenaTest::testScope()
+{
+    QVERIFY(IRArena::getCurrent() == nullptr);
+
+    IRArena *arena = new IRArena;
+
+    {
+        IRArena::Scope scope(arena);
+        QVERIFY(IRArena::getCurrent() == arena);
+
+        {
+            IRArena::Scope heapScope(nullptr);
+            QVERIFY(IRArena::getCurrent() == nullptr);
+
+            SharedExp e = Const::get(1);
+            QCOMPARE(arena->getNumLiveAllocations(), std::size_t(0));
+        }
+
+        QVERIFY(IRArena::getCurrent() == arena);
+
+        SharedExp e = Binary::get(opPlus, Const::get(1), Const::get(2));
+        QCOMPARE(arena->getNumLiveAllocations(), std::size_t(3));
+        QCOMPARE(e->toString(), QString("1 + 2"));
+
+        SharedExp clone = e->clone();
+        QCOMPARE(arena->getNumLiveAllocations(), std::size_t(6));
+        QVERIFY(*clone == *e);
+    }
+
+    QVERIFY(IRArena::getCurrent() == nullptr);
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(0));
+    arena->release();
+}
+
+
+void IRArenaTest::testRelease()
+{
+    IRArena *arena = new IRArena;
+    SharedExp e;
+
+    {
+        IRArena::Scope scope(arena);
+        e = Binary::get(opMinus, Const::get(5), Const::get(3));
+    }
+
+    // The arena is kept alive until the last node is destroyed.
+    arena->release();
+    QCOMPARE(e->toString(), QString("5 - 3"));
+    e.reset();
+}
+
+
+void IRArenaTest::testThreads()
+{
+    IRArena *arena = new IRArena;
+    std::vector<SharedExp> exps;
+
+    {
+        IRArena::Scope scope(arena);
+        for (int i = 0; i < 1000; ++i) {
+            exps.push_back(Binary::get(opPlus, Const::get(i), Const::get(1)));
+        }
+    }
+
+    // Nodes are destroyed on another thread while this thread allocates new ones
+    std::thread destroyer([&exps]() { exps.clear(); });
+
+    int numCreated = 0;
+
+    {
+        IRArena::Scope scope(arena);
+        for (int i = 0; i < 1000; ++i) {
+            SharedExp e = Binary::get(opMinus, Const::get(i), Const::get(1));
+            numCreated += (e != nullptr) ? 1 : 0;
+        }
+    }
+
+    destroyer.join();
+    QCOMPARE(numCreated, 1000);
+    QCOMPARE(arena->getNumLiveAllocations(), std::size_t(0));
+    arena->release();
+}
+
+
+QTEST_GUILESS_MAIN(IRArenaTest)
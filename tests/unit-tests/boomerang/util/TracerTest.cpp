@@ -0,0 +1,172 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "TracerTest.h"
+
+
+#include "boomerang/util/Tracer.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <thread>
+
+
+/// \returns all events recorded by all threads
+static std::vector<Tracer::Event> allEvents()
+{
+    std::vector<Tracer::Event> result;
+
+    for (const std::vector<Tracer::Event> &threadEvents : Tracer::get().getEvents()) {
+        result.insert(result.end(), threadEvents.begin(), threadEvents.end());
+    }
+
+    return result;
+}
+
+
+void TracerTest::cleanup()
+{
+    Tracer::get().disable();
+    Tracer::get().clear();
+}
+
+
+void TracerTest::testDisabled()
+{
+    QVERIFY(!Tracer::get().isEnabled());
+
+    {
+        TraceScope trace("test", "disabled");
+    }
+
+    QVERIFY(allEvents().empty());
+}
+
+
+void TracerTest::testScope()
+{
+    Tracer::get().enable();
+    QVERIFY(Tracer::get().isEnabled());
+
+    {
+        TraceScope outer("proc", "outer", "foo");
+        TraceScope inner("pass", QString("inner"));
+    }
+
+    const std::vector<Tracer::Event> events = allEvents();
+    QCOMPARE(events.size(), std::size_t(2));
+
+    // events are recorded when the scope ends
+    QCOMPARE(events[0].name, QString("inner"));
+    QCOMPARE(QString(events[0].category), QString("pass"));
+    QVERIFY(events[0].detail.isEmpty());
+
+    QCOMPARE(events[1].name, QString("outer"));
+    QCOMPARE(QString(events[1].category), QString("proc"));
+    QCOMPARE(events[1].detail, QString("foo"));
+
+    QVERIFY(events[1].beginNs <= events[0].beginNs);
+    QVERIFY(events[0].beginNs <= events[0].endNs);
+    QVERIFY(events[0].endNs <= events[1].endNs);
+}
+
+
+void TracerTest::testRingBuffer()
+{
+    Tracer::get().enable(4);
+
+    for (int i = 0; i < 10; i++) {
+        TraceScope trace("test", QString::number(i));
+    }
+
+    // only the newest events are kept, oldest first
+    const std::vector<Tracer::Event> events = allEvents();
+    QCOMPARE(events.size(), std::size_t(4));
+    QCOMPARE(events[0].name, QString("6"));
+    QCOMPARE(events[1].name, QString("7"));
+    QCOMPARE(events[2].name, QString("8"));
+    QCOMPARE(events[3].name, QString("9"));
+    QCOMPARE(Tracer::get().getNumDroppedEvents(), std::size_t(6));
+
+    // enabling again discards all events
+    Tracer::get().enable();
+    QVERIFY(allEvents().empty());
+    QCOMPARE(Tracer::get().getNumDroppedEvents(), std::size_t(0));
+}
+
+
+void TracerTest::testThreads()
+{
+    Tracer::get().enable();
+
+    {
+        TraceScope trace("test", "main");
+    }
+
+    std::thread worker([]() {
+        TraceScope trace("test", "worker");
+    });
+    worker.join();
+
+    // Events of finished threads are kept, and each thread has its own buffer
+    int numMain   = 0;
+    int numWorker = 0;
+
+    for (const std::vector<Tracer::Event> &threadEvents : Tracer::get().getEvents()) {
+        if (threadEvents.empty()) {
+            continue;
+        }
+
+        QCOMPARE(threadEvents.size(), std::size_t(1));
+        if (threadEvents[0].name == "main") {
+            numMain++;
+        }
+        else if (threadEvents[0].name == "worker") {
+            numWorker++;
+        }
+    }
+
+    QCOMPARE(numMain, 1);
+    QCOMPARE(numWorker, 1);
+}
+
+
+void TracerTest::testChromeTrace()
+{
+    Tracer::get().enable();
+
+    {
+        TraceScope trace("pass", "StatementPropagation", "main");
+    }
+
+    const QJsonDocument doc = QJsonDocument::fromJson(Tracer::get().toChromeTrace());
+    QVERIFY(doc.isObject());
+
+    const QJsonArray traceEvents = doc.object()["traceEvents"].toArray();
+    QJsonObject passEvent;
+
+    for (const QJsonValue &value : traceEvents) {
+        if (value.toObject()["ph"].toString() == "X") {
+            QVERIFY(passEvent.isEmpty());
+            passEvent = value.toObject();
+        }
+    }
+
+    QCOMPARE(passEvent["name"].toString(), QString("StatementPropagation"));
+    QCOMPARE(passEvent["cat"].toString(), QString("pass"));
+    QCOMPARE(passEvent["args"].toObject()["detail"].toString(), QString("main"));
+    QVERIFY(passEvent["ts"].toDouble() >= 0.0);
+    QVERIFY(passEvent["dur"].toDouble() >= 0.0);
+    QCOMPARE(doc.object()["otherData"].toObject()["droppedEvents"].toInt(), 0);
+}
+
+
+QTEST_GUILESS_MAIN(TracerTest)
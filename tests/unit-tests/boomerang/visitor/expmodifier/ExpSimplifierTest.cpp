@@ -835,6 +835,17 @@ void ExpSimplifierTest::testSimplify_data()
                                                           Location::regOf(REG_X86_ECX))),
                                   Location::regOf(REG_X86_EAX)),
                       Location::regOf(REG_X86_EAX));
+
+        // no rules for the outer expression, but still simplify subexpressions
+        TEST_SIMPLIFY("BinaryNoRule",
+                      Binary::get(opFPlus,
+                                  Binary::get(opPlus,
+                                              Location::regOf(REG_X86_EAX),
+                                              Const::get(0)),
+                                  Location::regOf(REG_X86_EDX)),
+                      Binary::get(opFPlus,
+                                  Location::regOf(REG_X86_EAX),
+                                  Location::regOf(REG_X86_EDX)));
     }
 
 